@@ -0,0 +1,28 @@
+// swift-tools-version: 5.9
+//
+//  Package.swift
+//  GraphsBenchmarks
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+//  Headless benchmarks for the Foundation-only parts of Graphs (parsing, ParsedFile, cache encoding and TableData).
+//  The app sources are shared through the symbolic links in Sources/GraphsBenchmarks/Shared so the benchmarks always measure the code that ships.
+
+import PackageDescription
+
+let package = Package(
+    name: "GraphsBenchmarks",
+    platforms: [.macOS(.v14)],
+    dependencies: [
+        .package(url: "https://github.com/apple/swift-collections.git", from: "1.1.0")
+    ],
+    targets: [
+        .executableTarget(
+            name: "GraphsBenchmarks",
+            dependencies: [
+                .product(name: "OrderedCollections", package: "swift-collections")
+            ]
+        )
+    ]
+)
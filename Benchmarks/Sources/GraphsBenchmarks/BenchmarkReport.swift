@@ -0,0 +1,134 @@
+//
+//  BenchmarkReport.swift
+//  GraphsBenchmarks
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// Machine readable results of a benchmark run.
+///
+/// Reports are written as JSON and a previous report can be used as the baseline for a later run.
+struct BenchmarkReport: Codable {
+    var formatVersion = 1
+
+    var date: Date = .now
+
+    var platform: String
+
+    var processorCount: Int
+
+    var iterations: Int
+
+    var scale: Double
+
+    var results: [StageResult] = []
+
+
+    /// Measurements for one stage of the pipeline over one corpus.
+    struct StageResult: Codable {
+        var corpus: String
+
+        var stage: String
+
+        /// Bytes processed by one iteration.
+        var bytes: Int
+
+        /// Data rows processed by one iteration.
+        var rows: Int
+
+        var medianSeconds: Double
+
+        var minimumSeconds: Double
+
+        var megabytesPerSecond: Double
+
+        var rowsPerSecond: Double
+
+        /// Peak resident set size while the stage ran.  Covers the whole process on macOS.
+        var peakResidentBytes: UInt64
+
+        /// Change in malloc'd bytes across one iteration while its result was still alive.
+        var heapBytesDelta: Int64
+
+        var key: String { corpus + "/" + stage }
+    }
+
+
+    static let encoder: JSONEncoder = {
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+        encoder.dateEncodingStrategy = .iso8601
+        return encoder
+    }()
+
+
+    static let decoder: JSONDecoder = {
+        let decoder = JSONDecoder()
+        decoder.dateDecodingStrategy = .iso8601
+        return decoder
+    }()
+
+
+    func write(to url: URL) throws {
+        let data = try BenchmarkReport.encoder.encode(self)
+        try data.write(to: url)
+    }
+
+
+    init(contentsOf url: URL) throws {
+        let data = try Data(contentsOf: url)
+        self = try BenchmarkReport.decoder.decode(BenchmarkReport.self, from: data)
+    }
+
+
+    init(platform: String, processorCount: Int, iterations: Int, scale: Double) {
+        self.platform = platform
+        self.processorCount = processorCount
+        self.iterations = iterations
+        self.scale = scale
+    }
+}
+
+
+
+// MARK: - Baseline Comparison
+extension BenchmarkReport {
+
+    struct Regression {
+        var key: String
+        var baselineSeconds: Double
+        var currentSeconds: Double
+
+        var change: Double {
+            currentSeconds / baselineSeconds - 1
+        }
+    }
+
+
+    /// Stages whose median time is more than `threshold` (e.g. 0.1 for 10%) slower than the baseline.
+    ///
+    /// Stages that are missing from either report are ignored.
+    func regressions(comparedTo baseline: BenchmarkReport, threshold: Double) -> [Regression] {
+        let baselineResults = Dictionary(baseline.results.map { ($0.key, $0) }, uniquingKeysWith: { first, _ in first })
+
+        var output: [Regression] = []
+
+        for nextResult in results {
+            guard let baselineResult = baselineResults[nextResult.key], baselineResult.medianSeconds > 0 else { continue }
+
+            let regression = Regression(key: nextResult.key,
+                                        baselineSeconds: baselineResult.medianSeconds,
+                                        currentSeconds: nextResult.medianSeconds)
+
+            if regression.change > threshold {
+                output.append(regression)
+            }
+        }
+
+        return output
+    }
+}
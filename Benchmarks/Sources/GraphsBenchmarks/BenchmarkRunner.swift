@@ -0,0 +1,217 @@
+//
+//  BenchmarkRunner.swift
+//  GraphsBenchmarks
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// A set of files that are parsed with known Parser Settings.
+struct Corpus {
+    var name: String
+
+    var files: [File]
+
+    struct File {
+        var url: URL
+        var settings: ParserSettingsStatic
+        var byteCount: Int
+    }
+
+
+    var byteCount: Int {
+        files.reduce(0) { $0 + $1.byteCount }
+    }
+}
+
+
+
+/// Runs every pipeline stage over a corpus and collects the results.
+struct BenchmarkRunner {
+    var iterations: Int
+
+    var stageFilter: Set<String>? = nil
+
+
+    static let stages = ["decode", "parse", "parse.projected", "preview", "appendRow", "cache.encode", "cache.decode", "tableData"]
+
+
+    func run(_ corpus: Corpus) async throws -> [BenchmarkReport.StageResult] {
+        var results: [BenchmarkReport.StageResult] = []
+
+        // Reference results are used as the inputs of the stages that don't start from the file
+        var referenceFiles: [ParsedFile] = []
+
+        for nextFile in corpus.files {
+            let parsedFile = try await Parser.parse(nextFile.url, using: nextFile.settings, into: DataItem.LocalID())
+            referenceFiles.append(parsedFile)
+        }
+
+        let rows = referenceFiles.reduce(0) { $0 + ($1.data.first?.data.count ?? 0) }
+        let bytes = corpus.byteCount
+
+        let encodedFiles = try referenceFiles.map { try ParsedFileArchive.encode($0) }
+        let encodedBytes = encodedFiles.reduce(0) { $0 + $1.count }
+
+        try verifyArchiveRoundTrip(of: referenceFiles, encodedFiles, in: corpus)
+
+        let rowsByFile = referenceFiles.map { tokenizedRows(of: $0) }
+
+
+        // Read and decode the file without parsing it
+        if let result = try await measure(corpus, "decode", bytes: bytes, rows: rows, {
+            try corpus.files.map { try Parser.content(for: $0.url, using: $0.settings) }
+        }) { results.append(result) }
+
+        // Full parse
+        if let result = try await measure(corpus, "parse", bytes: bytes, rows: rows, {
+            var output: [ParsedFile] = []
+            for nextFile in corpus.files {
+                output.append(try await Parser.parse(nextFile.url, using: nextFile.settings, into: DataItem.LocalID()))
+            }
+            return output
+        }) { results.append(result) }
+
+        // Parse with the projection of a two column Graph Template
+        if let result = try await measure(corpus, "parse.projected", bytes: bytes, rows: rows, {
+            var output: [ParsedFile] = []
+            let projection = ColumnProjection(numberOfGraphTemplateColumns: 3)
+            for nextFile in corpus.files {
+                output.append(try await Parser.parse(nextFile.url, using: nextFile.settings, into: DataItem.LocalID(), projection: projection))
+            }
+            return output
+        }) { results.append(result) }
+
+        // Bounded preview used by the Parser editor
+        if let result = try await measure(corpus, "preview", bytes: bytes, rows: rows, {
+            try corpus.files.map { try Parser.preview($0.url, using: $0.settings, into: DataItem.LocalID()) }
+        }) { results.append(result) }
+
+        // ParsedFile.appendRow with rows that were already tokenized
+        if let result = try await measure(corpus, "appendRow", bytes: bytes, rows: rows, {
+            rowsByFile.map { nextRows in
+                var parsedFile = ParsedFile(dataItemID: DataItem.LocalID())
+                for nextRow in nextRows {
+                    parsedFile.appendRow(nextRow)
+                }
+                return parsedFile
+            }
+        }) { results.append(result) }
+
+        // CacheManager stores ParsedFiles as a ParsedFileArchive
+        if let result = try await measure(corpus, "cache.encode", bytes: encodedBytes, rows: rows, {
+            try referenceFiles.map { try ParsedFileArchive.encode($0) }
+        }) { results.append(result) }
+
+        if let result = try await measure(corpus, "cache.decode", bytes: encodedBytes, rows: rows, {
+            try encodedFiles.map { try ParsedFileArchive(data: $0).parsedFile() }
+        }) { results.append(result) }
+
+        // Table Inspector rows
+        if let result = try await measure(corpus, "tableData", bytes: bytes, rows: rows, {
+            referenceFiles.map { TableData(columns: $0.data) }
+        }) { results.append(result) }
+
+        return results
+    }
+
+
+    /// Times `body` over `iterations` runs after one warm up run.
+    ///
+    /// Returns nil if the stage was filtered out.
+    private func measure<T>(_ corpus: Corpus, _ stage: String, bytes: Int, rows: Int, _ body: () async throws -> T) async throws -> BenchmarkReport.StageResult? {
+
+        if let stageFilter, !stageFilter.contains(stage) { return nil }
+
+        // Warm up
+        _ = try await body()
+
+        MemoryUsage.resetPeakResidentBytes()
+
+        let clock = ContinuousClock()
+        var durations: [Double] = []
+        durations.reserveCapacity(iterations)
+
+        var heapBytesDelta: Int64 = 0
+
+        for iteration in 0..<max(iterations, 1) {
+            let heapBefore = MemoryUsage.heapBytesInUse()
+            let start = clock.now
+
+            let output = try await body()
+
+            let duration = start.duration(to: clock.now)
+            durations.append(Double(duration.components.seconds) + Double(duration.components.attoseconds) * 1e-18)
+
+            if iteration == 0 {
+                heapBytesDelta = Int64(MemoryUsage.heapBytesInUse()) - Int64(heapBefore)
+            }
+
+            withExtendedLifetime(output) { }
+        }
+
+        durations.sort()
+
+        let median = durations[durations.count / 2]
+        let minimum = durations[0]
+
+        let result = BenchmarkReport.StageResult(corpus: corpus.name,
+                                                 stage: stage,
+                                                 bytes: bytes,
+                                                 rows: rows,
+                                                 medianSeconds: median,
+                                                 minimumSeconds: minimum,
+                                                 megabytesPerSecond: median > 0 ? Double(bytes) / 1_000_000 / median : 0,
+                                                 rowsPerSecond: median > 0 ? Double(rows) / median : 0,
+                                                 peakResidentBytes: MemoryUsage.peakResidentBytes(),
+                                                 heapBytesDelta: heapBytesDelta)
+
+        let milliseconds = String(format: "%10.3f ms", median * 1_000)
+        let throughput = String(format: "%9.1f MB/s %12.0f rows/s", result.megabytesPerSecond, result.rowsPerSecond)
+        
+        print(corpus.name.padding(toLength: 28, withPad: " ", startingAt: 0) + stage.padding(toLength: 16, withPad: " ", startingAt: 0) + milliseconds + throughput)
+
+        return result
+    }
+
+
+    /// Throws if a ParsedFile decoded from its archive differs from the ParsedFile that was encoded.
+    ///
+    /// The archive is meant to be lossless, e.g. "1.50" must not come back as "1.5".  ParsedFile isn't Equatable, so both are compared by their sorted JSON encoding, which covers every stored property.
+    private func verifyArchiveRoundTrip(of parsedFiles: [ParsedFile], _ encodedFiles: [Data], in corpus: Corpus) throws {
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = .sortedKeys
+
+        for (nextIndex, (nextParsedFile, nextEncodedFile)) in zip(parsedFiles, encodedFiles).enumerated() {
+            let decodedFile = try ParsedFileArchive(data: nextEncodedFile).parsedFile()
+
+            guard try encoder.encode(decodedFile) == encoder.encode(nextParsedFile) else {
+                throw BenchmarkError.archiveRoundTripMismatch(corpus.files[nextIndex].url.lastPathComponent)
+            }
+        }
+    }
+
+
+    enum BenchmarkError: Error, CustomStringConvertible {
+        case archiveRoundTripMismatch(String)
+
+        var description: String {
+            switch self {
+            case .archiveRoundTripMismatch(let fileName): return "The cache archive of \(fileName) does not decode to the ParsedFile that was encoded"
+            }
+        }
+    }
+
+
+    /// The data of a ParsedFile as rows.
+    private func tokenizedRows(of parsedFile: ParsedFile) -> [[String]] {
+        let numberOfRows = parsedFile.data.first?.data.count ?? 0
+
+        return (0..<numberOfRows).map { rowIndex in
+            parsedFile.data.map { rowIndex < $0.data.count ? $0.data[rowIndex] : "" }
+        }
+    }
+}
@@ -0,0 +1,229 @@
+//
+//  GraphsBenchmarks.swift
+//  GraphsBenchmarks
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+@main
+struct GraphsBenchmarks {
+
+    static let usage = """
+    USAGE: GraphsBenchmarks [options]
+
+    OPTIONS:
+      --iterations <n>        Measured iterations per stage (default: 5)
+      --scale <x>             Multiplies the number of rows in the synthetic files (default: 1)
+      --corpus <names>        Comma separated synthetic corpora to run (default: all)
+                              raman, afm-force-displacement, reactive-ink-xrd, reactive-ink-ftir, wide
+      --stage <names>         Comma separated stages to run (default: all)
+      --example-data <dir>    Also benchmark every folder in <dir> that contains a .gparser file
+      --output <file>         Write the JSON report to <file>
+      --baseline <file>       Compare against a previous JSON report
+      --threshold <x>         Allowed slowdown against the baseline (default: 0.10 = 10%)
+      --trace <on|off>        Record PipelineTrace intervals and print their statistics (default: off)
+    """
+
+
+    static func main() async {
+        do {
+            let options = try Options(arguments: Array(CommandLine.arguments.dropFirst()))
+
+            let exitCode = try await run(options)
+
+            exit(exitCode)
+        } catch let error as Options.OptionsError {
+            print("\(error)\n\n\(usage)")
+            exit(2)
+        } catch {
+            print("Benchmark failed: \(error)")
+            exit(1)
+        }
+    }
+
+
+    static func run(_ options: Options) async throws -> Int32 {
+        // Tracing adds overhead to every parsed line, so it is only on when asked for
+        PipelineTrace.isEnabled = options.trace
+        
+        let workingDirectory = FileManager.default.temporaryDirectory.appendingPathComponent("GraphsBenchmarks-\(UUID().uuidString)")
+
+        try FileManager.default.createDirectory(at: workingDirectory, withIntermediateDirectories: true)
+        defer { try? FileManager.default.removeItem(at: workingDirectory) }
+
+        var corpora = try syntheticCorpora(options, in: workingDirectory)
+
+        if let exampleDataURL = options.exampleDataURL {
+            corpora.append(contentsOf: try exampleCorpora(in: exampleDataURL))
+        }
+
+        var report = BenchmarkReport(platform: ProcessInfo.processInfo.operatingSystemVersionString,
+                                     processorCount: ProcessInfo.processInfo.activeProcessorCount,
+                                     iterations: options.iterations,
+                                     scale: options.scale)
+
+        let runner = BenchmarkRunner(iterations: options.iterations, stageFilter: options.stages)
+
+        for nextCorpus in corpora {
+            report.results.append(contentsOf: try await runner.run(nextCorpus))
+        }
+
+        if options.trace {
+            print("\n" + PipelineStatistics.shared.report() + "\n")
+        }
+
+        if let outputURL = options.outputURL {
+            try report.write(to: outputURL)
+            print("Wrote \(outputURL.path)")
+        }
+
+        guard let baselineURL = options.baselineURL else { return 0 }
+
+        let baseline = try BenchmarkReport(contentsOf: baselineURL)
+
+        let regressions = report.regressions(comparedTo: baseline, threshold: options.threshold)
+
+        if regressions.isEmpty {
+            print("No regressions over \(Int(options.threshold * 100))% against \(baselineURL.lastPathComponent)")
+            return 0
+        }
+
+        for nextRegression in regressions {
+            let change = String(format: "%+.1f%%", nextRegression.change * 100)
+            print("REGRESSION \(nextRegression.key): \(change) (\(nextRegression.baselineSeconds)s -> \(nextRegression.currentSeconds)s)")
+        }
+
+        return 1
+    }
+
+
+    // MARK: - Corpora
+    private static func syntheticCorpora(_ options: Options, in directory: URL) throws -> [Corpus] {
+        var specifications = SyntheticFileSpecification.examples(scale: options.scale)
+
+        if let corpusNames = options.corpusNames {
+            specifications = specifications.filter { corpusNames.contains($0.name) }
+        }
+
+        return try specifications.map { nextSpecification in
+            let url = try SyntheticFileGenerator.write(nextSpecification, into: directory)
+            let byteCount = try FileManager.default.attributesOfItem(atPath: url.path)[.size] as? Int ?? 0
+
+            return Corpus(name: nextSpecification.name,
+                          files: [Corpus.File(url: url, settings: nextSpecification.parserSettings, byteCount: byteCount)])
+        }
+    }
+
+
+    /// Every folder that contains a .gparser file becomes a corpus of the other files in that folder.
+    private static func exampleCorpora(in directory: URL) throws -> [Corpus] {
+        let fm = FileManager.default
+
+        guard let enumerator = fm.enumerator(at: directory, includingPropertiesForKeys: nil) else { return [] }
+
+        var corpora: [Corpus] = []
+
+        for case let parserURL as URL in enumerator where parserURL.pathExtension == "gparser" {
+            let data = try Data(contentsOf: parserURL)
+            let settings = try JSONDecoder().decode(ParserSettingsStatic.self, from: data)
+
+            let folderURL = parserURL.deletingLastPathComponent()
+
+            let fileURLs = try fm.contentsOfDirectory(at: folderURL, includingPropertiesForKeys: [.isRegularFileKey], options: [.skipsHiddenFiles])
+                .filter { !["gparser", "dgraph"].contains($0.pathExtension) }
+                .filter { (try? $0.resourceValues(forKeys: [.isRegularFileKey]).isRegularFile) == true }
+                .sorted { $0.lastPathComponent < $1.lastPathComponent }
+
+            let files = fileURLs.map { nextURL in
+                let byteCount = (try? fm.attributesOfItem(atPath: nextURL.path)[.size] as? Int) ?? 0
+                return Corpus.File(url: nextURL, settings: settings, byteCount: byteCount)
+            }
+
+            if files.isEmpty { continue }
+
+            let name = "example/" + folderURL.path.replacingOccurrences(of: directory.path, with: "").trimmingCharacters(in: CharacterSet(charactersIn: "/"))
+
+            corpora.append(Corpus(name: name, files: files))
+        }
+
+        return corpora
+    }
+}
+
+
+
+// MARK: - Options
+struct Options {
+    var iterations = 5
+    var scale = 1.0
+    var corpusNames: Set<String>? = nil
+    var stages: Set<String>? = nil
+    var exampleDataURL: URL? = nil
+    var outputURL: URL? = nil
+    var baselineURL: URL? = nil
+    var threshold = 0.10
+    var trace = false
+
+
+    init(arguments: [String]) throws {
+        var remaining = arguments[...]
+
+        while let argument = remaining.popFirst() {
+            if argument == "--help" || argument == "-h" {
+                throw OptionsError.help
+            }
+
+            guard let value = remaining.popFirst() else {
+                throw OptionsError.missingValue(argument)
+            }
+
+            switch argument {
+            case "--iterations":
+                guard let intValue = Int(value), intValue > 0 else { throw OptionsError.invalidValue(argument, value) }
+                iterations = intValue
+            case "--scale":
+                guard let doubleValue = Double(value), doubleValue > 0 else { throw OptionsError.invalidValue(argument, value) }
+                scale = doubleValue
+            case "--corpus":
+                corpusNames = Set(value.split(separator: ",").map(String.init))
+            case "--stage":
+                stages = Set(value.split(separator: ",").map(String.init))
+            case "--example-data":
+                exampleDataURL = URL(fileURLWithPath: value, isDirectory: true)
+            case "--output":
+                outputURL = URL(fileURLWithPath: value)
+            case "--baseline":
+                baselineURL = URL(fileURLWithPath: value)
+            case "--threshold":
+                guard let doubleValue = Double(value), doubleValue >= 0 else { throw OptionsError.invalidValue(argument, value) }
+                threshold = doubleValue
+            case "--trace":
+                guard ["on", "off"].contains(value) else { throw OptionsError.invalidValue(argument, value) }
+                trace = value == "on"
+            default:
+                throw OptionsError.unknownOption(argument)
+            }
+        }
+    }
+
+
+    enum OptionsError: Error, CustomStringConvertible {
+        case help
+        case missingValue(String)
+        case invalidValue(String, String)
+        case unknownOption(String)
+
+        var description: String {
+            switch self {
+            case .help: return "Graphs parser and pipeline benchmarks."
+            case .missingValue(let option): return "Missing value for \(option)"
+            case .invalidValue(let option, let value): return "Invalid value for \(option): \(value)"
+            case .unknownOption(let option): return "Unknown option: \(option)"
+            }
+        }
+    }
+}
@@ -0,0 +1,85 @@
+//
+//  MemoryUsage.swift
+//  GraphsBenchmarks
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#endif
+
+
+/// Process memory readings used to attribute memory to a benchmark stage.
+enum MemoryUsage {
+
+    /// Resets the peak resident set size so the next reading only covers the current stage.
+    ///
+    /// Only supported on Linux (writing 5 to /proc/self/clear_refs resets VmHWM).  On macOS the peak covers the lifetime of the process.
+    static func resetPeakResidentBytes() {
+        #if os(Linux)
+        try? "5".write(toFile: "/proc/self/clear_refs", atomically: false, encoding: .ascii)
+        #endif
+    }
+
+
+    /// Peak resident set size in bytes.
+    static func peakResidentBytes() -> UInt64 {
+        #if os(Linux)
+        if let peak = procStatusValue(named: "VmHWM:") {
+            return peak
+        }
+        #endif
+
+        var usage = rusage()
+        getrusage(RUSAGE_SELF, &usage)
+
+        #if os(Linux)
+        // ru_maxrss is in kilobytes on Linux
+        return UInt64(usage.ru_maxrss) * 1024
+        #else
+        return UInt64(usage.ru_maxrss)
+        #endif
+    }
+
+
+    /// Bytes currently allocated by malloc.
+    ///
+    /// The difference across a stage approximates the bytes the stage allocated and kept alive.  Allocation counts require Instruments or heaptrack.
+    static func heapBytesInUse() -> UInt64 {
+        #if canImport(Darwin)
+        var statistics = malloc_statistics_t()
+        malloc_zone_statistics(nil, &statistics)
+        return UInt64(statistics.size_in_use)
+        #elseif canImport(Glibc)
+        return UInt64(mallinfo2().uordblks)
+        #else
+        return 0
+        #endif
+    }
+
+
+    #if os(Linux)
+    /// Reads a "Name:   1234 kB" value from /proc/self/status.
+    private static func procStatusValue(named name: String) -> UInt64? {
+        guard let status = try? String(contentsOfFile: "/proc/self/status", encoding: .utf8) else {
+            return nil
+        }
+
+        for line in status.split(separator: "\n") where line.hasPrefix(name) {
+            let fields = line.split(whereSeparator: { $0 == " " || $0 == "\t" })
+
+            guard fields.count >= 2, let kilobytes = UInt64(fields[1]) else { return nil }
+
+            return kilobytes * 1024
+        }
+
+        return nil
+    }
+    #endif
+}
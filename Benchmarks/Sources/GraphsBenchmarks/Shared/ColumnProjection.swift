@@ -0,0 +1 @@
+../../../../Graphs/Controllers/Processed Data Manager/Parsing/ColumnProjection.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../Graphs/Controllers/Processed Data Manager/ProcessedData/DataColumn.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../Graphs/Helper/Helper Extensions/Int_Extensions.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../Graphs/Data Models/StructsAndEnums/NewLineType.swift
\ No newline at end of file
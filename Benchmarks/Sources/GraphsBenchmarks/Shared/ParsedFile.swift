@@ -0,0 +1 @@
+../../../../Graphs/Controllers/Processed Data Manager/Parsing/ParsedFile.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../Graphs/Controllers/Processed Data Manager/Caching/ParsedFileArchive.swift
\ No newline at end of file
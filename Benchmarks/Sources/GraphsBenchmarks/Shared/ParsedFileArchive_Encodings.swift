@@ -0,0 +1 @@
+../../../../Graphs/Controllers/Processed Data Manager/Caching/ParsedFileArchive_Encodings.swift
\ No newline at end of file
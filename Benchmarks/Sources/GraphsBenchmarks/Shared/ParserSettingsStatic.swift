@@ -0,0 +1 @@
+../../../../Graphs/Data Models/StructsAndEnums/ParserSettingsStatic.swift
\ No newline at end of file
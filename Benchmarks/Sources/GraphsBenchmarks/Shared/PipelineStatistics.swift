@@ -0,0 +1 @@
+../../../../Graphs/Helper/Help Objects/PipelineStatistics.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../Graphs/Helper/Help Objects/PipelineTrace.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../Graphs/Helper/Helper Protocols/PresentableName.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../Graphs/Helper/Helper Protocols/ProvidesToolTip.swift
\ No newline at end of file
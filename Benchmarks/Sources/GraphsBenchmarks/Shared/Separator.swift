@@ -0,0 +1 @@
+../../../../Graphs/Data Models/StructsAndEnums/Separator.swift
\ No newline at end of file
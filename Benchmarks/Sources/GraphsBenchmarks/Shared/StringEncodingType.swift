@@ -0,0 +1 @@
+../../../../Graphs/Data Models/StructsAndEnums/StringEncodingType.swift
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../Graphs/View Models/Inspector View Models/Table Inspector VM/TableData.swift
\ No newline at end of file
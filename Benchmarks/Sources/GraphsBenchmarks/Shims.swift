@@ -0,0 +1,25 @@
+//
+//  Shims.swift
+//  GraphsBenchmarks
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+// The shared parsing sources only use the LocalID types of the SwiftData models.  These stand-ins keep SwiftData, SwiftUI and DataGraph out of the benchmarks.
+
+enum DataItem {
+    struct LocalID: Identifiable, Hashable, Codable, Sendable {
+        var id = UUID()
+    }
+}
+
+
+enum ParserSettings {
+    struct LocalID: Identifiable, Hashable, Codable, Sendable {
+        var id = UUID()
+    }
+}
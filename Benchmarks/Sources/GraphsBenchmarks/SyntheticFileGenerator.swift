@@ -0,0 +1,296 @@
+//
+//  SyntheticFileGenerator.swift
+//  GraphsBenchmarks
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// Describes a deterministic synthetic data file and the Parser Settings needed to parse it.
+struct SyntheticFileSpecification: Codable, Sendable {
+    var name: String
+
+    var numberOfRows: Int
+
+    var numberOfColumns: Int
+
+    /// Lines of "key = value" experimental details at the top of the file.
+    var numberOfDetailLines: Int
+
+    /// Lines of column headers following the experimental details.
+    var numberOfHeaderLines: Int
+
+    var separator: Separator
+
+    /// Line ending written to the file.  `.auto` writes \r\n so that the Parser has to strip the \r characters.
+    var newLineType: NewLineType
+
+    var stringEncodingType: StringEncodingType
+
+    var valueStyle: ValueStyle
+
+    var seed: UInt64
+
+
+    enum ValueStyle: String, Codable, Sendable {
+        /// Increasing x value followed by noisy intensities, like Raman and XRD exports.
+        case spectrum
+
+        /// Fixed width values with leading spaces, like AFM force-displacement exports.
+        case padded
+
+        /// Scientific notation, like FTIR exports from the reactive-ink sets.
+        case scientific
+    }
+}
+
+
+
+// MARK: - Example Shaped Specifications
+extension SyntheticFileSpecification {
+
+    /// Two tab separated columns without details or headers.  Shaped like `Example Data/Raman`.
+    static func raman(scale: Double) -> SyntheticFileSpecification {
+        SyntheticFileSpecification(name: "raman",
+                                   numberOfRows: scaled(1_015, by: scale),
+                                   numberOfColumns: 2,
+                                   numberOfDetailLines: 0,
+                                   numberOfHeaderLines: 0,
+                                   separator: .tab,
+                                   newLineType: .CRLF,
+                                   stringEncodingType: .ascii,
+                                   valueStyle: .spectrum,
+                                   seed: 1)
+    }
+
+
+    /// A block of experimental details, one header line and four padded tab separated columns.  Shaped like `Example Data/AFM force-Displacement`.
+    static func afmForceDisplacement(scale: Double) -> SyntheticFileSpecification {
+        SyntheticFileSpecification(name: "afm-force-displacement",
+                                   numberOfRows: scaled(1_024, by: scale),
+                                   numberOfColumns: 4,
+                                   numberOfDetailLines: 13,
+                                   numberOfHeaderLines: 1,
+                                   separator: .tab,
+                                   newLineType: .CRLF,
+                                   stringEncodingType: .automatic,
+                                   valueStyle: .padded,
+                                   seed: 2)
+    }
+
+
+    /// Comment style details followed by three space separated columns.  Shaped like the XRD files in the reactive-ink sets.
+    static func reactiveInkXRD(scale: Double) -> SyntheticFileSpecification {
+        SyntheticFileSpecification(name: "reactive-ink-xrd",
+                                   numberOfRows: scaled(2_247, by: scale),
+                                   numberOfColumns: 3,
+                                   numberOfDetailLines: 11,
+                                   numberOfHeaderLines: 0,
+                                   separator: .space,
+                                   newLineType: .auto,
+                                   stringEncodingType: .windowsCP1250,
+                                   valueStyle: .spectrum,
+                                   seed: 3)
+    }
+
+
+    /// Two comma separated columns in scientific notation.  Shaped like the FTIR files in the reactive-ink sets.
+    static func reactiveInkFTIR(scale: Double) -> SyntheticFileSpecification {
+        SyntheticFileSpecification(name: "reactive-ink-ftir",
+                                   numberOfRows: scaled(3_000, by: scale),
+                                   numberOfColumns: 2,
+                                   numberOfDetailLines: 0,
+                                   numberOfHeaderLines: 0,
+                                   separator: .comma,
+                                   newLineType: .CRLF,
+                                   stringEncodingType: .utf8,
+                                   valueStyle: .scientific,
+                                   seed: 4)
+    }
+
+
+    /// A wide spectrometer style export used to measure ColumnProjection.
+    static func wide(scale: Double) -> SyntheticFileSpecification {
+        SyntheticFileSpecification(name: "wide",
+                                   numberOfRows: scaled(2_000, by: scale),
+                                   numberOfColumns: 64,
+                                   numberOfDetailLines: 4,
+                                   numberOfHeaderLines: 2,
+                                   separator: .comma,
+                                   newLineType: .LF,
+                                   stringEncodingType: .utf8,
+                                   valueStyle: .scientific,
+                                   seed: 5)
+    }
+
+
+    static func examples(scale: Double) -> [SyntheticFileSpecification] {
+        [.raman(scale: scale), .afmForceDisplacement(scale: scale), .reactiveInkXRD(scale: scale), .reactiveInkFTIR(scale: scale), .wide(scale: scale)]
+    }
+
+
+    private static func scaled(_ numberOfRows: Int, by scale: Double) -> Int {
+        max(Int((Double(numberOfRows) * scale).rounded()), 1)
+    }
+}
+
+
+
+// MARK: - Parser Settings
+extension SyntheticFileSpecification {
+
+    /// Parser Settings that match the layout of the generated file.
+    var parserSettings: ParserSettingsStatic {
+        let hasExperimentalDetails = numberOfDetailLines > 0
+        let hasHeader = numberOfHeaderLines > 0
+
+        // Line numbers are one-based.  Absent sections use 0...0 so that they never match a line.
+        let detailsStart = hasExperimentalDetails ? 1 : 0
+        let detailsEnd = hasExperimentalDetails ? numberOfDetailLines : 0
+        let headerStart = hasHeader ? numberOfDetailLines + 1 : 0
+        let headerEnd = hasHeader ? numberOfDetailLines + numberOfHeaderLines : 0
+
+        return ParserSettingsStatic(name: name,
+                                    localID: ParserSettings.LocalID(),
+                                    creationDate: .now,
+                                    lastModified: .now,
+                                    newLineType: newLineType,
+                                    stringEncodingType: stringEncodingType,
+                                    hasExperimentalDetails: hasExperimentalDetails,
+                                    experimentalDetailsSeparator: .none,
+                                    experimentalDetailsStart: detailsStart,
+                                    experimentalDetailsEnd: detailsEnd,
+                                    hasHeader: hasHeader,
+                                    headerSeparator: separator,
+                                    headerStart: headerStart,
+                                    headerEnd: headerEnd,
+                                    hasData: true,
+                                    dataStart: numberOfDetailLines + numberOfHeaderLines + 1,
+                                    dataSeparator: separator,
+                                    stopDataAtFirstEmptyLine: true,
+                                    hasFooter: false)
+    }
+}
+
+
+
+// MARK: - Generating Files
+struct SyntheticFileGenerator {
+
+    /// Writes the file described by `specification` into `directory` and returns its URL.
+    ///
+    /// The same specification always produces the same bytes.
+    static func write(_ specification: SyntheticFileSpecification, into directory: URL) throws -> URL {
+        let content = content(for: specification)
+
+        let encoding: String.Encoding = specification.stringEncodingType == .automatic ? .utf8 : specification.stringEncodingType.encoding
+
+        guard let data = content.data(using: encoding) else {
+            throw GeneratorError.couldNotEncode(specification.name)
+        }
+
+        let url = directory.appendingPathComponent(specification.name + ".txt")
+
+        try data.write(to: url)
+
+        return url
+    }
+
+
+    static func content(for specification: SyntheticFileSpecification) -> String {
+        var random = SplitMix64(seed: specification.seed)
+
+        let lineEnding = specification.newLineType == .auto ? "\r\n" : specification.newLineType.stringLiteral
+        let separator = separatorString(for: specification.separator)
+
+        var lines: [String] = []
+        lines.reserveCapacity(specification.numberOfDetailLines + specification.numberOfHeaderLines + specification.numberOfRows)
+
+        for detailIndex in 0..<specification.numberOfDetailLines {
+            lines.append("# Detail \(detailIndex + 1) = \(random.nextDouble(in: 0..<1_000))")
+        }
+
+        for headerIndex in 0..<specification.numberOfHeaderLines {
+            let header = (0..<specification.numberOfColumns).map { "Column \($0 + 1) - \(headerIndex + 1)" }
+            lines.append(header.joined(separator: separator))
+        }
+
+        for rowIndex in 0..<specification.numberOfRows {
+            var row: [String] = []
+            row.reserveCapacity(specification.numberOfColumns)
+
+            for columnIndex in 0..<specification.numberOfColumns {
+                let value: Double
+
+                if columnIndex == 0 {
+                    value = 100.0 + Double(rowIndex) * 0.714462
+                } else {
+                    value = 1_000.0 * random.nextDouble(in: -1..<1)
+                }
+
+                row.append(format(value, style: specification.valueStyle))
+            }
+
+            lines.append(row.joined(separator: separator))
+        }
+
+        return lines.joined(separator: lineEnding) + lineEnding
+    }
+
+
+    private static func separatorString(for separator: Separator) -> String {
+        switch separator {
+        case .none: return ""
+        case .colon: return ":"
+        case .comma: return ","
+        case .semicolon: return ";"
+        case .space: return " "
+        case .tab: return "\t"
+        case .whitespace: return "   "
+        }
+    }
+
+
+    private static func format(_ value: Double, style: SyntheticFileSpecification.ValueStyle) -> String {
+        switch style {
+        case .spectrum:
+            return String(value)
+        case .padded:
+            return String(format: "%10.6f", value)
+        case .scientific:
+            return String(format: "%.6e", value)
+        }
+    }
+
+
+    enum GeneratorError: Error {
+        case couldNotEncode(String)
+    }
+}
+
+
+
+/// Small deterministic random number generator so generated files are identical on every platform.
+struct SplitMix64: RandomNumberGenerator {
+    private var state: UInt64
+
+    init(seed: UInt64) {
+        state = seed
+    }
+
+    mutating func next() -> UInt64 {
+        state &+= 0x9E3779B97F4A7C15
+        var z = state
+        z = (z ^ (z >> 30)) &* 0xBF58476D1CE4E5B9
+        z = (z ^ (z >> 27)) &* 0x94D049BB133111EB
+        return z ^ (z >> 31)
+    }
+
+    mutating func nextDouble(in range: Range<Double>) -> Double {
+        let unit = Double(next() >> 11) / Double(1 << 53)
+        return range.lowerBound + unit * (range.upperBound - range.lowerBound)
+    }
+}
@@ -20,6 +20,7 @@ class AppController {
     var exportManager: ExportManager
     var importManager: ImportManager
     var processedDataManager: ProcessDataManager
+    var sessionManager: SessionManager
     var menuViewModel: MenuViewModel
     
     
@@ -29,6 +30,7 @@ class AppController {
     var dataListVM: DataListViewModel
     var graphListVM: GraphControllerListViewModel
     var preferencesVM: PreferencesViewModel
+    var cachePreferencesVM: CachePreferencesViewModel
     
     init() {
         var url = try? FileManager.default.url(for: .libraryDirectory,
@@ -50,6 +52,7 @@ class AppController {
         let localProcessedDataManager = ProcessDataManager(cacheManager: localCacheManager, dataSource: nil)
         let localImportManager = ImportManager(localDataController, localSelectionManager)
         let localExportManager = ExportManager(localDataController, localProcessedDataManager, localSelectionManager)
+        let localSessionManager = SessionManager(localDataController, localSelectionManager, localProcessedDataManager, localCacheManager)
         
         
         // Use a Common Manager to simplify the API for view models
@@ -67,6 +70,7 @@ class AppController {
         importManager = localImportManager
         processedDataManager = localProcessedDataManager
         selectionManager = localSelectionManager
+        sessionManager = localSessionManager
         menuViewModel = localMenuManager
         
         
@@ -77,19 +81,35 @@ class AppController {
         inspectorVM = InspectorViewModel(commonManagers)
         sourceListVM = SourceListViewModel(commonManagers)
         preferencesVM = PreferencesViewModel(localDataController)
+        cachePreferencesVM = CachePreferencesViewModel(localCacheManager, localDataController)
         
         
         // Delegates and DataSources
         localDataController.delegate = self
         localSelectionManager.delegate = self
         localProcessedDataManager.dataSource = self
+        localDataController.fileChangeMonitor.delegate = self
         
         
-        // Set initial node selection to top-level Node
-        if let firstNode = localDataController.topNode() {
+        // Restore the selection of the last session, otherwise select the top-level Node
+        if localSessionManager.restoreLastSession() == false, let firstNode = localDataController.topNode() {
             let firstNodeIDs = Set([firstNode.id])
             localSelectionManager.selectedNodeIDs = firstNodeIDs
         }
+        
+        localSessionManager.startSaving()
+        
+        
+        // Once every Data Item is fetched, find the files that changed while the app was closed, then remove the cache of Data Items that no longer exist
+        Task(priority: .utility) {
+            await localDataController.dataItemLoading?.value
+            
+            let dataItems = localDataController.allDataItems
+            let dataItemIDs = Set(localDataController.dataItemsByLocalID.keys)
+            
+            await localProcessedDataManager.scanForChangedFiles(in: dataItems)
+            localCacheManager.compact(existingDataItemIDs: dataItemIDs)
+        }
     }
 }
 
@@ -109,9 +129,9 @@ extension AppController: @preconcurrency DataControllerDelegate {
         
     }
     
-    func preparingToDelete(nodes: [Node]) {
-        selectionManager.preparingToDelete(nodes: nodes)
-        processedDataManager.preparingToDelete(nodes: nodes)
+    func preparingToDelete(nodes: [Node], containing dataItems: [DataItem]) {
+        selectionManager.preparingToDelete(nodes: nodes, containing: dataItems)
+        processedDataManager.preparingToDelete(dataItems: dataItems)
     }
     
     func preparingToDelete(dataItems: [DataItem]) {
@@ -147,18 +167,28 @@ extension AppController: @preconcurrency DataControllerDelegate {
 extension AppController: @preconcurrency SelectionManagerDelegate {
     func selectedNodeIDsDidChange(_ nodeIDs: Set<Node.ID>) {
 
-        dataController.selectedNodeIDs = Array(nodeIDs)
+        dataController.selectedNodeIDs = nodeIDs
         
         inspectorVM.nodeInspectorVM.selectedNodeDidChange()
+        sessionManager.selectionDidChange()
     }
     
     func selectedDataItemsDidChange(_ dataItemsIDs: Set<DataItem.ID>) {
         
-        dataController.selectedDataItemIDs = Array(dataItemsIDs)
+        dataController.selectedDataItemIDs = dataItemsIDs
         graphListVM.updateProcessedData()
         
         let nc = NotificationCenter.default
         nc.post(name: .selectedDataItemDidChange, object: nil, userInfo: nil)
+        
+        sessionManager.selectionDidChange()
+    }
+}
+
+
+extension AppController: @preconcurrency FileChangeMonitorDelegate {
+    func filesDidChange(dataItems: [DataItem], graphTemplates: [GraphTemplate]) {
+        processedDataManager.filesDidChange(dataItems: dataItems, graphTemplates: graphTemplates)
     }
 }
 
@@ -33,7 +33,46 @@ class DataController {
     
     
     // MARK: - Data Items
-    var allDataItems: [DataItem] = []
+    /// Every Data Item keyed by its ID.  Filled by `loadDataItems()` and patched by `apply(_:)`.
+    private(set) var dataItemsByID: [DataItem.ID : DataItem] = [:]
+    
+    var allDataItems: [DataItem] {
+        Array(dataItemsByID.values)
+    }
+    
+    /// Every Data Item keyed by its LocalID (used by drag and drop).  Patched with `dataItemsByID`.
+    private(set) var dataItemsByLocalID: [DataItem.LocalID : DataItem] = [:]
+    
+    /// True while `loadDataItems()` fetches the pages of Data Items.  Until then `allDataItems` and the indices only contain the Data Items fetched so far.
+    var isLoadingDataItems = false
+    
+    /// Fetches the pages of Data Items.  Await its value before using every Data Item (e.g. to compact the cache).
+    @ObservationIgnored
+    var dataItemLoading: Task<Void, Never>? = nil
+    
+    /// Fetches the remaining pages of the Data Items of the selected Nodes ahead of `dataItemLoading`.
+    @ObservationIgnored
+    var subtreeDataItemLoading: Task<Void, Never>? = nil
+    
+    
+    // MARK: - Node Lookup
+    /// Every Node keyed by its ID.  Rebuilt by `fetchAllObjects()` and patched by `apply(_:)`.
+    private(set) var nodesByID: [Node.ID : Node] = [:]
+    
+    /// Every Node keyed by its LocalID (used by drag and drop).  Patched by `apply(_:)`.
+    private(set) var nodesByLocalID: [Node.LocalID : Node] = [:]
+    
+    /// The Data Items below each Node.  Rebuilt by `fetchAllObjects()`, filled by `loadDataItems()` and patched by `apply(_:)`.
+    @ObservationIgnored
+    let subtreeIndex = NodeSubtreeIndex()
+    
+    /// Search index for `filter`.  Rebuilt by `fetchAllObjects()` and patched by `apply(_:)`.
+    @ObservationIgnored
+    private let searchIndex = DataItemSearchIndex()
+    
+    /// Reports the Data Item and Graph Template files that change on disk.  Rebuilt by `fetchAllObjects()` and patched by `apply(_:)`.
+    @ObservationIgnored
+    let fileChangeMonitor = FileChangeMonitor()
     
     private var _filter: String = ""
     var filter: String {
@@ -54,32 +93,34 @@ class DataController {
     
     private var filteredDataItems: OrderedSet<DataItem> = [] {
         didSet {
+            if !isPatchingVisableItems {
+                sortVisableItems()
+            }
             updateSelectedDataItems()
         }
     }
     
     
-    var visableItems: OrderedSet<DataItem> {
-        
-        let sortedDataItems = OrderedSet(filteredDataItems.sorted(using: sort))
-        
-        return sortedDataItems
-    }
+    /// `filteredDataItems` sorted by `sort`.
+    ///
+    /// Sorted again only when the filter, the sort or most of the filtered Data Items change.  Small changes made by `apply(_:)` are inserted with a binary search.
+    private(set) var visableItems: OrderedSet<DataItem> = []
+    
+    @ObservationIgnored
+    private var isPatchingVisableItems = false
     
 
     
     var sort: [KeyPathComparator<DataItem>] = [.init(\.name), .init(\.nodePath)] {
         didSet {
-            updateFilteredDataItems()
+            sortVisableItems()
+            updateSelectedDataItems()
         }
     }
     
     
     // MARK: - Selections
-    // This is temporary and used to make the visibleItems a computed property
-    // TODO: Remove when visibleItems transitioned to stored property that is updated manually
-    
-    var selectedNodeIDs: [Node.ID] = [] {
+    var selectedNodeIDs: Set<Node.ID> = [] {
         didSet {
             updateSelectedNodes()
         }
@@ -95,17 +136,12 @@ class DataController {
     private var dataItemsFromSelectedNodes: OrderedSet<DataItem> {
         // For initial simplicity, we will make this a computed property
         get {
-            var items: OrderedSet<DataItem> = []
-            for nextNode in selectedNodes {
-                items.formUnion(nextNode.flattenedDataItems())
-            }
-            
-            return items
+            return OrderedSet(dataItems(inSubtreesOf: selectedNodes))
         }
     }
     
     
-    var selectedDataItemIDs: [DataItem.ID] = [] {
+    var selectedDataItemIDs: Set<DataItem.ID> = [] {
         didSet {
             updateSelectedDataItems()
         }
@@ -114,6 +150,20 @@ class DataController {
     var selectedDataItems: [DataItem] = []
     
     
+    // MARK: - Bulk Operations
+    /// Progress of the bulk operation (e.g. a directory import) that is currently running, or nil.
+    var operationProgress: OperationProgress? = nil
+    
+    /// Operations on at least this many models run on the PersistenceActor instead of the main context.
+    static let bulkOperationThreshold = PersistenceActor.saveBatchSize
+    
+    @ObservationIgnored
+    var bulkOperationTask: Task<Void, Never>? = nil
+    
+    @ObservationIgnored
+    private var persistenceActor: PersistenceActor? = nil
+    
+    
     // MARK: - Initialization
     init(withDelegate delegate: DataControllerDelegate?) {
         let sharedModelContainer: ModelContainer = {
@@ -139,18 +189,39 @@ class DataController {
         container = sharedModelContainer
         
         
-        modelContext = ModelContext(sharedModelContainer)
+        // The main context merges the changes saved by the PersistenceActor.  Edits made on the main context (e.g. in the inspectors) are written by its autosave.
+        modelContext = sharedModelContainer.mainContext
+        modelContext.autosaveEnabled = true
 
         self.delegate = delegate
         
         fetchAllObjects()
         
         updateFilteredDataItems()
+        
+        registerForNotifications()
 
     }
     
     
     
+    // MARK: - Persistence Actor
+    /// The actor used for bulk mutations.
+    func backgroundPersistence() async -> PersistenceActor {
+        if let persistenceActor { return persistenceActor }
+        
+        let container = self.container
+        
+        // A ModelActor created on the main actor would run its work on the main thread
+        let newActor = await Task.detached { PersistenceActor(modelContainer: container) }.value
+        
+        persistenceActor = newActor
+        
+        return newActor
+    }
+    
+    
+    
     // MARK: - Nodes
     func allNodes() -> [Node] {
         do {
@@ -171,29 +242,41 @@ class DataController {
     }
     
     
+    /// The Data Items inside the Nodes and all of their sub Nodes.
+    func dataItems(inSubtreesOf nodes: [Node]) -> [DataItem] {
+        var ids: Set<DataItem.ID> = []
+        
+        for nextNode in nodes {
+            ids.formUnion(subtreeIndex.dataItemIDs(inSubtreeOf: nextNode.id))
+        }
+        
+        return ids.compactMap { dataItemsByID[$0] }
+    }
+    
+    
     
     
     
     // MARK: - Fetching Data
+    /// Fetches the Nodes, Parser Settings, Graph Templates and File Extensions, and starts fetching the Data Items in pages.
     func fetchAllObjects() {
         fetchRootNodes()
         fetchParserSettings()
         fetchGraphTemplates()
-        fetchDataItems()
         fetchFileExtensions()
+        let nodes = allNodes()
+        nodesByID = Dictionary(nodes.map { ($0.id, $0) }, uniquingKeysWith: { first, _ in first })
+        nodesByLocalID = Dictionary(nodes.map { ($0.localID, $0) }, uniquingKeysWith: { first, _ in first })
+        dataItemsByID = [:]
+        dataItemsByLocalID = [:]
+        NodePathCache.shared.removeAll()
+        subtreeIndex.rebuild(nodes: nodes, dataItems: [])
+        searchIndex.rebuild(nodes: nodes, dataItems: [])
+        fileChangeMonitor.rebuild(dataItems: [], graphTemplates: graphTemplates)
         updateFilteredDataItems()
-    }
-    
-    
-    private func fetchDataItems() {
-        do {
-            let sortOrder = [SortDescriptor<DataItem>(\.name)]
-            let descriptor = FetchDescriptor<DataItem>(sortBy: sortOrder)
-            allDataItems = try modelContext.fetch(descriptor)
-        } catch  {
-            Logger.dataController.info("DataController: Failed to Fetch All DataItems")
-            allDataItems = []
-        }
+        
+        // The Data Items are added to the indices page by page, so launch doesn't wait for the whole library
+        loadDataItems()
     }
     
     private func fetchRootNodes() {
@@ -259,25 +342,249 @@ class DataController {
     
     
     
+    // MARK: - Applying Changes
+    /// Patches the fetched models, the root Nodes and the filtered Data Items with the changes made by a mutation.
+    ///
+    /// Use instead of `fetchAllObjects()` after a mutation.  Only the changed models are visited, except that removing Data Items from the filtered Data Items is a single pass over them.
+    func apply(_ changes: ModelChanges) {
+        if changes.isEmpty { return }
+        
+        subtreeIndex.apply(changes)
+        NodePathCache.shared.apply(changes)
+        searchIndex.apply(changes)
+        fileChangeMonitor.apply(changes)
+        EffectiveSettingsResolver.shared.apply(changes)
+        
+        
+        // Data Items and Nodes
+        var removedURLs: [URL] = []
+        
+        for nextID in changes.deletedDataItemIDs {
+            if let removedDataItem = dataItemsByID.removeValue(forKey: nextID) {
+                dataItemsByLocalID.removeValue(forKey: removedDataItem.localID)
+                removedURLs.append(removedDataItem.url)
+            }
+        }
+        
+        FileMetadataStore.shared.remove(removedURLs)
+        
+        for nextDataItem in changes.insertedDataItems {
+            dataItemsByID[nextDataItem.id] = nextDataItem
+            dataItemsByLocalID[nextDataItem.localID] = nextDataItem
+        }
+        
+        for nextID in changes.deletedNodeIDs {
+            if let removedNode = nodesByID.removeValue(forKey: nextID) {
+                nodesByLocalID.removeValue(forKey: removedNode.localID)
+            }
+        }
+        
+        for nextNode in changes.insertedNodes {
+            nodesByID[nextNode.id] = nextNode
+            nodesByLocalID[nextNode.localID] = nextNode
+        }
+        
+        
+        // Root Nodes
+        if changes.changesNodes {
+            let movedIntoParentIDs = Set(changes.movedNodes.filter { $0.parent != nil }.map { $0.id })
+            
+            var localRootNodes = rootNodes.filter { !changes.deletedNodeIDs.contains($0.id) && !movedIntoParentIDs.contains($0.id) }
+            
+            localRootNodes.append(contentsOf: changes.insertedNodes.filter { $0.parent == nil })
+            
+            rootNodes = localRootNodes.sorted { $0.name < $1.name }
+        }
+        
+        
+        // Parser Settings, Graph Templates and File Extensions
+        if !changes.insertedParserSettings.isEmpty || !changes.deletedParserSettingsIDs.isEmpty {
+            parserSettings = (parserSettings.filter { !changes.deletedParserSettingsIDs.contains($0.id) } + changes.insertedParserSettings)
+                .sorted { $0.name < $1.name }
+        }
+        
+        if !changes.insertedGraphTemplates.isEmpty || !changes.deletedGraphTemplateIDs.isEmpty {
+            graphTemplates = (graphTemplates.filter { !changes.deletedGraphTemplateIDs.contains($0.id) } + changes.insertedGraphTemplates)
+                .sorted { $0.name < $1.name }
+        }
+        
+        if !changes.insertedFileExtensions.isEmpty || !changes.deletedFileExtensionIDs.isEmpty {
+            fileExtensions = (fileExtensions.filter { !changes.deletedFileExtensionIDs.contains($0.id) } + changes.insertedFileExtensions)
+                .sorted { $0.fileExtension < $1.fileExtension }
+        }
+        
+        
+        // Filtered Data Items
+        applyToFilteredDataItems(changes)
+    }
+    
+    
+    private func applyToFilteredDataItems(_ changes: ModelChanges) {
+        var localFilteredDataItems = filteredDataItems
+        var removedDataItems: [DataItem] = []
+        var insertedDataItems: [DataItem] = []
+        
+        if !changes.deletedDataItemIDs.isEmpty || !changes.deletedNodeIDs.isEmpty {
+            
+            // Data Items of deleted Nodes lose their Node once the delete is saved
+            localFilteredDataItems.removeAll { nextDataItem in
+                let isRemoved: Bool
+                
+                if changes.deletedDataItemIDs.contains(nextDataItem.id) {
+                    isRemoved = true
+                } else if let node = nextDataItem.node {
+                    isRemoved = changes.deletedNodeIDs.contains(node.id)
+                } else {
+                    isRemoved = true
+                }
+                
+                if isRemoved { removedDataItems.append(nextDataItem) }
+                
+                return isRemoved
+            }
+        }
+        
+        
+        // Data Items whose name or folder path may have changed, which can move them in the sort
+        let editedDataItems = changes.editedDataItems + changes.movedDataItems + dataItems(inSubtreesOf: changes.movedNodes + changes.editedNodes)
+        
+        // Inserted and moved Data Items, including every Data Item below a moved Node
+        var candidates = changes.insertedDataItems + changes.movedDataItems + dataItems(inSubtreesOf: changes.movedNodes)
+        
+        // Edits only change which Data Items match the filter
+        if !filter.isEmpty {
+            candidates.append(contentsOf: changes.editedDataItems)
+            candidates.append(contentsOf: dataItems(inSubtreesOf: changes.editedNodes))
+        }
+        
+        if !candidates.isEmpty {
+            let selectedNodeIDs = Set(selectedNodes.map { $0.id })
+            
+            for nextDataItem in candidates {
+                if isVisible(nextDataItem, inNodesWithIDs: selectedNodeIDs) {
+                    if localFilteredDataItems.append(nextDataItem).inserted {
+                        insertedDataItems.append(nextDataItem)
+                    }
+                } else if localFilteredDataItems.remove(nextDataItem) != nil {
+                    removedDataItems.append(nextDataItem)
+                }
+            }
+        }
+        
+        // Visible Data Items that were edited are removed and inserted again at their new position
+        let insertedIDs = Set(insertedDataItems.map { $0.id })
+        let repositionedDataItems = editedDataItems.filter { visableItems.contains($0) && localFilteredDataItems.contains($0) && !insertedIDs.contains($0.id) }
+        
+        let numberOfPatches = removedDataItems.count + insertedDataItems.count + repositionedDataItems.count
+        
+        if numberOfPatches == 0 { return }
+        
+        // Sorting everything is cheaper than many binary insertions
+        if numberOfPatches > visableItems.count / 4 {
+            filteredDataItems = localFilteredDataItems
+            return
+        }
+        
+        patchVisableItems(removing: removedDataItems + repositionedDataItems, inserting: insertedDataItems + repositionedDataItems)
+        
+        isPatchingVisableItems = true
+        filteredDataItems = localFilteredDataItems
+        isPatchingVisableItems = false
+    }
+    
+    
+    /// True if the Data Item is inside one of the Nodes (or their sub Nodes) and matches the filter.
+    private func isVisible(_ dataItem: DataItem, inNodesWithIDs nodeIDs: Set<Node.ID>) -> Bool {
+        guard let nodeID = dataItem.node?.id, subtreeIndex.isNode(nodeID, inSubtreeOfAny: nodeIDs) else { return false }
+        
+        return filter.isEmpty || searchIndex.dataItem(dataItem, matches: filter)
+    }
+    
+    
+    
     // MARK: - Filtering Selected DataItems
     func updateSelectedNodes() {
-        let ids = selectedNodeIDs
-        
-        let nodes = allNodes()
+        let filteredNodes = selectedNodeIDs.compactMap { nodesByID[$0] }
         
-        let filteredNodes = nodes.filter( { ids.contains([$0.id]) })
+        // Show the selected Nodes without waiting for the remaining pages
+        if isLoadingDataItems {
+            loadDataItems(inSubtreesOf: filteredNodes)
+        }
         
-        self.selectedNodes = filteredNodes
+        self.selectedNodes = filteredNodes.sorted { $0.name < $1.name }
     }
     
     func updateSelectedDataItems() {
         
-        let ids = selectedDataItemIDs
-        let items = self.visableItems
-        let filteredItems = items.filter({ids.contains([$0.id])})
-        let sortedFilteredItems = filteredItems.sorted(using: sort)
+        // Keep the order of visableItems without visiting the items that aren't selected
+        let indexedItems: [(index: Int, dataItem: DataItem)] = selectedDataItemIDs.compactMap { nextID in
+            guard let dataItem = dataItemsByID[nextID], let index = visableItems.firstIndex(of: dataItem) else { return nil }
+            return (index, dataItem)
+        }
+        
+        selectedDataItems = indexedItems.sorted { $0.index < $1.index }.map { $0.dataItem }
+    }
+    
+    
+    
+    // MARK: - Sorting
+    private func sortVisableItems() {
+        visableItems = OrderedSet(filteredDataItems.sorted(using: sort))
+    }
+    
+    
+    private func patchVisableItems(removing removedDataItems: [DataItem], inserting insertedDataItems: [DataItem]) {
+        var localVisableItems = visableItems
+        
+        for nextDataItem in removedDataItems {
+            localVisableItems.remove(nextDataItem)
+        }
+        
+        for nextDataItem in insertedDataItems {
+            localVisableItems.insert(nextDataItem, at: insertionIndex(of: nextDataItem, in: localVisableItems))
+        }
+        
+        visableItems = localVisableItems
+    }
+    
+    
+    /// Index after every item that sorts before or the same as `dataItem`.
+    private func insertionIndex(of dataItem: DataItem, in sortedItems: OrderedSet<DataItem>) -> Int {
+        var lowerBound = 0
+        var upperBound = sortedItems.count
+        
+        while lowerBound < upperBound {
+            let middle = (lowerBound + upperBound) / 2
+            
+            if compareForSort(sortedItems[middle], dataItem) == .orderedDescending {
+                upperBound = middle
+            } else {
+                lowerBound = middle + 1
+            }
+        }
+        
+        return lowerBound
+    }
+    
+    
+    /// Key paths whose values are read in the background by the FileMetadataStore.
+    private static let fileMetadataKeyPaths: Set<PartialKeyPath<DataItem>> = [\DataItem.fileSize, \DataItem.contentCreationDate, \DataItem.contentModificationDate]
+    
+    
+    /// True if the sort uses file metadata, which may arrive after the Data Items were sorted.
+    private var sortUsesFileMetadata: Bool {
+        sort.contains { DataController.fileMetadataKeyPaths.contains($0.keyPath) }
+    }
+    
+    
+    private func compareForSort(_ lhs: DataItem, _ rhs: DataItem) -> ComparisonResult {
+        for nextComparator in sort {
+            let result = nextComparator.compare(lhs, rhs)
+            
+            if result != .orderedSame { return result }
+        }
         
-        selectedDataItems = sortedFilteredItems
+        return .orderedSame
     }
     
 
@@ -286,7 +593,9 @@ class DataController {
         if filter.isEmpty {
             self.filteredDataItems = dataItemsFromSelectedNodes
         } else {
-            let filteredItems = dataItemsFromSelectedNodes.filter({$0.containsFilter(filter)})
+            let matchingIDs = searchIndex.dataItemIDs(matching: filter, subtreeIndex: subtreeIndex)
+            
+            let filteredItems = dataItemsFromSelectedNodes.filter({ matchingIDs.contains($0.id) })
             
             let filteredItemIDs = filteredItems.map({ $0.id })
             
@@ -297,3 +606,26 @@ class DataController {
     }
     
 }
+
+
+
+// MARK: - Notifications
+extension DataController {
+    private func registerForNotifications() {
+        let nc = NotificationCenter.default
+        
+        nc.addObserver(forName: .fileMetadataDidChange,
+                       object: nil,
+                       queue: .main,
+                       using: notification_fileMetadataDidChange(_:))
+    }
+    
+    
+    /// Missing file sizes and dates sort as empty values until they are read, so sort again once they arrive.
+    private func notification_fileMetadataDidChange(_ notification: Notification) {
+        guard sortUsesFileMetadata else { return }
+        
+        sortVisableItems()
+        updateSelectedDataItems()
+    }
+}
@@ -15,7 +15,8 @@ protocol DataControllerDelegate {
     // MARK: - Nodes and DataItems
     func newObjects(nodes: [Node], dataItems: [DataItem], graphTemplates: [GraphTemplate], parserSettings: [ParserSettings])
     
-    func preparingToDelete(nodes: [Node])
+    /// - Parameter dataItems: The Data Items inside the Nodes and their sub Nodes.
+    func preparingToDelete(nodes: [Node], containing dataItems: [DataItem])
     
     func preparingToDelete(dataItems: [DataItem])
     
@@ -0,0 +1,127 @@
+//
+//  DataController_BulkOperations.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+import SwiftData
+import OSLog
+
+
+// MARK: - Bulk Operations
+extension DataController {
+
+    /// Runs `operation` once every earlier bulk operation has finished and publishes its progress in `operationProgress`.
+    ///
+    /// Pending changes in the main context are saved first so the PersistenceActor sees them.  Cancelling the progress cancels the operation; batches that were already saved are kept.
+    func performBulkOperation(_ title: String, totalUnitCount: Int? = nil, _ operation: @escaping (OperationProgress) async throws -> Void) {
+        let previousOperation = bulkOperationTask
+
+        bulkOperationTask = Task {
+            await previousOperation?.value
+
+            try? modelContext.save()
+
+            let progress = OperationProgress(title: title)
+            progress.update(phase: title, completed: 0, total: totalUnitCount)
+            operationProgress = progress
+
+            let operationTask = Task {
+                try await operation(progress)
+            }
+
+            progress.cancellationHandler = { operationTask.cancel() }
+
+            do {
+                try await operationTask.value
+            } catch is CancellationError {
+                Logger.dataController.info("DataController: \(title) was cancelled")
+            } catch {
+                Logger.dataController.info("DataController: \(title) failed with error: \(error)")
+            }
+
+            progress.finish()
+            if operationProgress === progress { operationProgress = nil }
+        }
+    }
+
+
+    /// Runs `body` on the main actor once every earlier bulk operation has finished, without publishing any progress.
+    ///
+    /// Used to keep a change that may run immediately behind a bulk operation it depends on.  Bulk operations started by `body` are queued after it.
+    func performAfterBulkOperations(_ body: @escaping () -> Void) {
+        let previousOperation = bulkOperationTask
+
+        bulkOperationTask = Task {
+            await previousOperation?.value
+
+            body()
+        }
+    }
+
+
+    /// A BatchHandler that merges each saved batch into the main context and advances `progress`.
+    func mergingBatchHandler(_ progress: OperationProgress) -> PersistenceActor.BatchHandler {
+        return { [weak self] batch in
+            await self?.mergeBackgroundChanges(batch)
+            await progress.advance(by: batch.count)
+        }
+    }
+
+
+    /// Applies a batch saved by the PersistenceActor to the models fetched by the main context.
+    ///
+    /// The delegate is told about the deleted models of each batch as it is merged, so models of a cancelled operation that weren't deleted stay selected and processed.
+    func mergeBackgroundChanges(_ batch: PersistenceActor.Batch) {
+        let deletedNodes = batch.deletedNodeIDs.compactMap { nodesByID[$0] }
+        let deletedDataItems = batch.deletedDataItemIDs.compactMap { dataItemsByID[$0] }
+
+        if deletedNodes.isEmpty == false {
+            delegate?.preparingToDelete(nodes: deletedNodes, containing: dataItems(inSubtreesOf: deletedNodes))
+        }
+
+        if deletedDataItems.isEmpty == false {
+            delegate?.preparingToDelete(dataItems: deletedDataItems)
+        }
+
+        var changes = ModelChanges()
+
+        changes.insertedNodes = batch.insertedNodeIDs.compactMap { modelContext.model(for: $0) as? Node }
+        changes.deletedNodeIDs = Set(batch.deletedNodeIDs)
+        changes.movedNodes = batch.movedNodeIDs.compactMap { modelContext.model(for: $0) as? Node }
+
+        changes.insertedDataItems = batch.insertedDataItemIDs.compactMap { modelContext.model(for: $0) as? DataItem }
+        changes.deletedDataItemIDs = Set(batch.deletedDataItemIDs)
+        changes.movedDataItems = batch.movedDataItemIDs.compactMap { modelContext.model(for: $0) as? DataItem }
+
+        apply(changes)
+    }
+
+
+    /// Applies `body` to every item on the main actor, yielding between batches so the UI stays responsive.
+    ///
+    /// Used for changes that post notifications from the models (e.g. assigning Parser Settings), which can't be made on the PersistenceActor.  Fewer than `bulkOperationThreshold` items are changed immediately.
+    func performInBatches<T>(_ title: String, on items: [T], _ body: @escaping (T) -> Void) {
+        if items.count < DataController.bulkOperationThreshold {
+            items.forEach(body)
+            return
+        }
+
+        performBulkOperation(title, totalUnitCount: items.count) { progress in
+            for nextBatch in stride(from: 0, to: items.count, by: PersistenceActor.saveBatchSize) {
+                try Task.checkCancellation()
+
+                let batchEnd = min(nextBatch + PersistenceActor.saveBatchSize, items.count)
+
+                items[nextBatch..<batchEnd].forEach(body)
+
+                progress.advance(by: batchEnd - nextBatch)
+
+                await Task.yield()
+            }
+        }
+    }
+}
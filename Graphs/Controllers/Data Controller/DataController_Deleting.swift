@@ -13,13 +13,7 @@ extension DataController {
     
     // MARK: - DataItems and Nodes
     func delete(_ nodeIDs: [Node.ID]) {
-        var nodesToDelete: [Node] = []
-        
-        for nextNode in allNodes() {
-            if nodeIDs.contains(where: { $0 == nextNode.id}) {
-                nodesToDelete.append(nextNode)
-            }
-        }
+        let nodesToDelete = nodeIDs.compactMap { nodesByID[$0] }
         
         delete(nodesToDelete)
     }
@@ -29,20 +23,53 @@ extension DataController {
         
         if nodes.isEmpty { return }
             
-        delegate?.preparingToDelete(nodes: nodes)
+        // Sub Nodes are deleted by the cascade
+        var deletedNodeIDs: Set<Node.ID> = []
+        
+        for nextNode in nodes {
+            deletedNodeIDs.insert(nextNode.id)
+            deletedNodeIDs.formUnion(subtreeIndex.subNodeIDs(inSubtreeOf: nextNode.id))
+        }
+        
+        // Large subtrees are deleted in batches on the PersistenceActor, which tells the delegate about each saved batch
+        let numberOfNodes = deletedNodeIDs.count
+        
+        if numberOfNodes >= DataController.bulkOperationThreshold {
+            let nodeIDs = nodes.map { $0.persistentModelID }
+            
+            performBulkOperation("Deleting Folders", totalUnitCount: numberOfNodes) { progress in
+                let persistence = await self.backgroundPersistence()
+                
+                try await persistence.deleteNodes(nodeIDs, didSave: self.mergingBatchHandler(progress))
+            }
+            return
+        }
+        
+        delegate?.preparingToDelete(nodes: nodes, containing: dataItems(inSubtreesOf: nodes))
         
         for nextNode in nodes {
             modelContext.delete(nextNode)
         }
         try? modelContext.save()
         
-        fetchAllObjects()
+        apply(ModelChanges(deletedNodeIDs: deletedNodeIDs))
     }
     
     private func delete(_ dataItems: [DataItem]) {
         if dataItems.isEmpty { return }
         
         // ADD
+        if dataItems.count >= DataController.bulkOperationThreshold {
+            let dataItemIDs = dataItems.map { $0.persistentModelID }
+            
+            performBulkOperation("Deleting Data", totalUnitCount: dataItemIDs.count) { progress in
+                let persistence = await self.backgroundPersistence()
+                
+                try await persistence.deleteDataItems(dataItemIDs, didSave: self.mergingBatchHandler(progress))
+            }
+            return
+        }
+        
         delegate?.preparingToDelete(dataItems: dataItems)
         
         for nextItem in dataItems {
@@ -51,7 +78,7 @@ extension DataController {
         
         try? modelContext.save()
         
-        
+        apply(ModelChanges(deletedDataItemIDs: Set(dataItems.map { $0.id })))
     }
     
     func delete(_ dataItems: [DataItem], andThenNodes nodes: [Node]) {
@@ -61,11 +88,19 @@ extension DataController {
             delete(dataItems)
         }
         
-        if nodes.count > 0 {
+        if nodes.count == 0 { return }
+        
+        // Large Data Item deletes are queued as a bulk operation, so the Nodes are queued behind them instead of being deleted first
+        if dataItems.count >= DataController.bulkOperationThreshold {
+            let nodeIDs = nodes.map { $0.id }
+            
+            // Looked up again by ID, in case an earlier operation deleted some of them
+            performAfterBulkOperations { [weak self] in
+                self?.delete(nodeIDs)
+            }
+        } else {
             delete(nodes)
         }
-        
-        fetchAllObjects()
     }
     
     
@@ -76,7 +111,8 @@ extension DataController {
         
         modelContext.delete(parserSettings)
         try? modelContext.save()
-        //fetchAllObjects()
+        
+        apply(ModelChanges(deletedParserSettingsIDs: [parserSettings.id]))
     }
     
     
@@ -87,7 +123,8 @@ extension DataController {
         
         modelContext.delete(graphTemplate)
         try? modelContext.save()
-        fetchAllObjects()
+        
+        apply(ModelChanges(deletedGraphTemplateIDs: [graphTemplate.id]))
     }
     
     
@@ -97,7 +134,7 @@ extension DataController {
         
         try? modelContext.save()
         
-        fetchFileExtensions()
+        apply(ModelChanges(deletedFileExtensionIDs: [fileExtension.id]))
     }
     
 
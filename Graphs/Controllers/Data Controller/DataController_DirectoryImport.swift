@@ -0,0 +1,103 @@
+//
+//  DataController_DirectoryImport.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+import SwiftData
+import OSLog
+
+
+// MARK: - Importing Directories
+extension DataController {
+
+    /// Imports directory trees into `parentNode` without blocking the main actor.
+    ///
+    /// The trees are scanned concurrently off of the main actor by a DirectoryScanner.  The PersistenceActor then inserts the Nodes and Data Items, saving and merging them into the main context in batches.  Graph Templates and Parser Settings found in the directories are imported last, followed by a single delegate callback.
+    ///
+    /// Progress is published through `operationProgress`.  Cancelling keeps the batches that were already saved.
+    func importDirectories(_ urls: [URL], intoNode parentNode: Node?) {
+        if urls.isEmpty { return }
+
+        performBulkOperation("Importing") { progress in
+            try await self.runDirectoryImport(urls, intoNode: parentNode, progress: progress)
+        }
+    }
+
+
+    private func runDirectoryImport(_ urls: [URL], intoNode parentNode: Node?, progress: OperationProgress) async throws {
+
+        // Scan
+        progress.update(phase: "Scanning Folders")
+
+        let scanner = DirectoryScanner(allowedExtensions: fileExtensions.map { $0.fileExtension })
+
+        let directories = try await withThrowingTaskGroup(of: (Int, DirectoryScanner.Directory).self) { group in
+            for (index, nextURL) in urls.enumerated() {
+                group.addTask {
+                    let directory = try await scanner.scan(nextURL) { numberOfDataFiles in
+                        await progress.advance(by: numberOfDataFiles)
+                    }
+                    return (index, directory)
+                }
+            }
+
+            var output: [(Int, DirectoryScanner.Directory)] = []
+            for try await nextResult in group {
+                output.append(nextResult)
+            }
+
+            return output.sorted { $0.0 < $1.0 }.map { $0.1 }
+        }
+
+
+        // Insert
+        let totalNumberOfItems = directories.reduce(0) { $0 + $1.numberOfItems }
+
+        progress.update(phase: "Adding", completed: 0, total: totalNumberOfItems)
+
+        let persistence = await backgroundPersistence()
+
+        let result = try await persistence.insert(directories, intoNodeWith: parentNode?.persistentModelID, didSave: mergingBatchHandler(progress))
+
+        progress.cancellationHandler = nil
+
+
+        // Graph Templates and Parser Settings found in the directories
+        let im = ImportMonitor.shared
+        im.importStarting()
+
+        var newGraphTemplates: [GraphTemplate] = []
+        for nextGraphTemplate in result.graphTemplateURLs {
+            let node = modelContext.model(for: nextGraphTemplate.nodeID) as? Node
+
+            if let newGraphTemplate = importGraphTemplate(withURL: nextGraphTemplate.url, intoNode: node, shouldUseImportMonitor: true) {
+                newGraphTemplates.append(newGraphTemplate)
+            }
+        }
+
+        var newParsers: [ParserSettings] = []
+        for nextParser in result.parserSettingsURLs {
+            let node = modelContext.model(for: nextParser.nodeID) as? Node
+
+            if let newParser = importParser(from: nextParser.url, intoNode: node) {
+                newParsers.append(newParser)
+            }
+        }
+
+        im.importComplete()
+
+        if !newGraphTemplates.isEmpty || !newParsers.isEmpty {
+            try? modelContext.save()
+        }
+
+        // The Nodes and Data Items were applied as each batch was saved
+        let topLevelNodes = result.topLevelNodeIDs.compactMap { modelContext.model(for: $0) as? Node }
+
+        // Select the new folders rather than every new Data Item
+        delegate?.newObjects(nodes: topLevelNodes, dataItems: [], graphTemplates: newGraphTemplates, parserSettings: newParsers)
+    }
+}
@@ -15,24 +15,42 @@ extension DataController {
         
         
         let nodesToMove = nodes(for: nodeIDs)
-        move(nodes: nodesToMove, to: node)
+        let dataItemstoMove = dataItems(for: dataItemIDs)
         
+        // Large moves are made in batches on the PersistenceActor
+        let numberOfModels = nodesToMove.count + dataItemstoMove.count
         
-        let dataItemstoMove = dataItems(for: dataItemIDs)
-        move(dataItems: dataItemstoMove, to: node)
+        if numberOfModels >= DataController.bulkOperationThreshold {
+            let nodeModelIDs = nodesToMove.map { $0.persistentModelID }
+            let dataItemModelIDs = dataItemstoMove.map { $0.persistentModelID }
+            let targetID = node.persistentModelID
+            
+            performBulkOperation("Moving", totalUnitCount: numberOfModels) { progress in
+                let persistence = await self.backgroundPersistence()
+                
+                try await persistence.move(dataItemIDs: dataItemModelIDs, nodeIDs: nodeModelIDs, to: targetID, didSave: self.mergingBatchHandler(progress))
+            }
+            return
+        }
+        
+        let movedNodes = move(nodes: nodesToMove, to: node)
         
+        let movedDataItems = move(dataItems: dataItemstoMove, to: node)
         
-        self.fetchAllObjects()
+        apply(ModelChanges(movedNodes: movedNodes, movedDataItems: movedDataItems))
         
     }
     
     
-    private func move(nodes: [Node], to node: Node) {
+    /// - Returns: The Nodes that were moved.
+    private func move(nodes: [Node], to node: Node) -> [Node] {
         var movableNodes: [Node] = []
         
+        let movingNodeIDs = Set(nodes.map { $0.id })
+        
         for nextNode in nodes {
             if let nextNodeParent = nextNode.parent {
-                let isMovable = !nodes.contains(nextNodeParent)
+                let isMovable = !movingNodeIDs.contains(nextNodeParent.id)
                 
                 if isMovable {
                     movableNodes.append(nextNode)
@@ -47,61 +65,46 @@ extension DataController {
         for nextMovableNode in movableNodes {
             nextMovableNode.setParent(node)
         }
+        
+        return movableNodes
     }
     
     
-    private func move(dataItems: [DataItem], to node: Node) {
+    /// - Returns: The Data Items that were moved.
+    private func move(dataItems: [DataItem], to node: Node) -> [DataItem] {
+        var movedDataItems: [DataItem] = []
         
         for nextDataItem in dataItems {
             
             // Only move the DataItems that aren't already in the target Node
-            let isMovable = nextDataItem.node?.localID != node.localID
+            let isMovable = nextDataItem.node != nil && nextDataItem.node?.localID != node.localID
             
             if isMovable {
-                nextDataItem.node? = node
+                nextDataItem.node = node
+                movedDataItems.append(nextDataItem)
             }
         }
+        
+        return movedDataItems
     }
     
     
     
-    // TODO: Update to use a fetch description instead of filtering
     private func nodes(for localIDs: [Node.LocalID]) -> [Node] {
-        let allNodes = allNodes()
-        
-        if allNodes.count == 0 { return [] }
-        
-        let filteredNodes = allNodes.filter( { localIDs.contains($0.localID)} )
-        
-        return filteredNodes
+        return localIDs.compactMap { nodesByLocalID[$0] }
     }
     
     private func nodes(for ids: [Node.ID]) -> [Node] {
-        let allNodes = allNodes()
-        
-        if allNodes.count == 0 { return [] }
-        
-        let filteredNodes = allNodes.filter( { ids.contains($0.id)} )
-        
-        return filteredNodes
+        return ids.compactMap { nodesByID[$0] }
     }
     
     
-    // TODO: Update to use a fetch description instead of filtering
     private func dataItems(for localIDs: [DataItem.LocalID]) -> [DataItem] {
-        if allDataItems.count == 0 { return [] }
-        
-        let filteredDataItems = allDataItems.filter( {localIDs.contains( $0.localID )} )
-        
-        return filteredDataItems
+        return localIDs.compactMap { dataItemsByLocalID[$0] }
     }
     
     
     private func dataItems(for ids: [DataItem.ID]) -> [DataItem] {
-        if allDataItems.count == 0 { return [] }
-        
-        let filteredDataItems = allDataItems.filter( {ids.contains( $0.id )} )
-        
-        return filteredDataItems
+        return ids.compactMap { dataItemsByID[$0] }
     }
 }
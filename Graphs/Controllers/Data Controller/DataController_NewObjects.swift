@@ -93,14 +93,8 @@ extension DataController {
         
         
         
-        var newNodes: [Node] = []
-        
-        for nextDirectory in directories {
-            // UPDATE
-            if let newNode = importDirectory(nextDirectory, intoNode: parentNode) {
-                newNodes.append(newNode)
-            }
-        }
+        // Directory trees are scanned and inserted asynchronously
+        importDirectories(directories, intoNode: parentNode)
         
         let useImportMonitor = !urlsOnlyContainDataGraphFiles(urls)
         var newGraphTemplates: [GraphTemplate] = []
@@ -119,53 +113,20 @@ extension DataController {
             }
         }
         
-        fetchAllObjects()
-        
-        delegate?.newObjects(nodes: newNodes, dataItems: newDataItems, graphTemplates: newGraphTemplates, parserSettings: newParsers)
-    }
-    
-    
-    
-    private func importDirectory(_ url: URL, intoNode parentNode: Node?) -> Node? {
-        
-        // Check that url exists and is a directory
-        let fm = FileManager.default
-        var isDir = ObjCBool(false)
-        
-        
-        guard fm.fileExists(atPath: url.path, isDirectory: &isDir) else {
-            
-            Logger.dataController.info("File does not exist")
-            return nil
-        }
-
-        
-        let type = URL.URLType(withURL: url)
-        
-        if type == .file {
-            Logger.dataController.info("Error.  importDirectory should only be seeing directories\n\(url)\n is not a directory")
-            return nil
-        }
-        
-        // Create Node and Insert into context
-        let newNode = Node(url: url)
-        newNode.postModelContextInsertInitialization(parentNode)
-        
-        modelContext.insert(newNode)
-        
-        
-        
-        
-        if let contentURLs = try? fm.contentsOfDirectory(at: url, includingPropertiesForKeys: [.isRegularFileKey]) {
-            try? self.internalImportURLs(contentURLs, into: newNode)
-        }
+        // Directories report their own new objects once they are inserted
+        if newDataItems.isEmpty && newGraphTemplates.isEmpty && newParsers.isEmpty { return }
         
+        // Saving replaces the temporary identifiers of the new models, which the indices use as keys
+        try? modelContext.save()
         
+        // Graph Templates and Parser Settings were applied as they were imported
+        apply(ModelChanges(insertedDataItems: newDataItems))
         
-        return newNode
+        delegate?.newObjects(nodes: [], dataItems: newDataItems, graphTemplates: newGraphTemplates, parserSettings: newParsers)
     }
     
     
+    
     private func importFile(_ url: URL, intoNode parentNode: Node) -> DataItem? {
         
         // Check that the url exists and it is a file
@@ -210,15 +171,14 @@ extension DataController {
         
         try? modelContext.save()
         
-         
-        fetchAllObjects()
+        apply(ModelChanges(insertedNodes: [newNode]))
  
         delegate?.newObjects(nodes: [newNode], dataItems: [], graphTemplates: [], parserSettings: [])
     }
     
     
     // MARK: - Graph Template
-    private func importGraphTemplate(withURL url: URL, intoNode node: Node? = nil, shouldUseImportMonitor: Bool) -> GraphTemplate? {
+    func importGraphTemplate(withURL url: URL, intoNode node: Node? = nil, shouldUseImportMonitor: Bool) -> GraphTemplate? {
         
         if url.pathExtension != "dgraph" {
             return nil
@@ -238,7 +198,9 @@ extension DataController {
         
         newGraphTemplate.postModelContextInsertInitialization(node)
         
-        fetchGraphTemplates()
+        try? modelContext.save()
+        
+        apply(ModelChanges(insertedGraphTemplates: [newGraphTemplate]))
                 
         delegate?.newGraphTemplate(newGraphTemplate)
         
@@ -271,7 +233,9 @@ extension DataController {
         
         newParserSettings.postModelContextInsertInitialization(node)
         
-        fetchParserSettings()
+        try? modelContext.save()
+        
+        apply(ModelChanges(insertedParserSettings: [newParserSettings]))
         
         delegate?.newParserSetting(newParserSettings)
         
@@ -298,7 +262,9 @@ extension DataController {
             
             newParserSettings.postModelContextInsertInitialization(parentNode)
             
-            fetchParserSettings()
+            try? modelContext.save()
+            
+            apply(ModelChanges(insertedParserSettings: [newParserSettings]))
             
             delegate?.newParserSetting(newParserSettings)
             
@@ -323,7 +289,7 @@ extension DataController {
         
         try? modelContext.save()
         
-        fetchFileExtensions()
+        apply(ModelChanges(insertedFileExtensions: [newFileExtension]))
         
         return newFileExtension
     }
@@ -341,7 +307,9 @@ extension DataController {
         
         modelContext.insert(duplicateGraphTemplate)
         
-        fetchGraphTemplates()
+        try? modelContext.save()
+        
+        apply(ModelChanges(insertedGraphTemplates: [duplicateGraphTemplate]))
         
         delegate?.newGraphTemplate(duplicateGraphTemplate)
         
@@ -361,7 +329,9 @@ extension DataController {
         
         modelContext.insert(duplicatedParserSettings)
         
-        fetchParserSettings()
+        try? modelContext.save()
+        
+        apply(ModelChanges(insertedParserSettings: [duplicatedParserSettings]))
         
         delegate?.newParserSetting(duplicatedParserSettings)
         
@@ -0,0 +1,147 @@
+//
+//  DataController_PagedLoading.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+import SwiftData
+import OSLog
+
+
+// MARK: - Paged Loading
+/// Data Items are fetched after launch in pages of `dataItemPageSize`, and each page is added to the indices with `apply(_:)`.  Launch only waits for the Nodes, so its cost doesn't grow with the number of Data Items.  The Data Items of a Node selected before its page arrives are fetched right away.
+///
+/// Only the properties read by the indices and the Data List are fetched.  The bookmark and the notes of a Data Item are read from the store when they are first used.
+extension DataController {
+
+    static let dataItemPageSize = 2_000
+
+    private static let dataItemPropertiesToFetch: [PartialKeyPath<DataItem>] = [
+        \DataItem.localID, \DataItem.url, \DataItem.name, \DataItem.creationDate,
+        \DataItem.graphTemplateInputType, \DataItem.parserSettingsInputType, \DataItem.rating
+    ]
+
+
+    /// Starts fetching every Data Item.
+    func loadDataItems() {
+        dataItemLoading?.cancel()
+        isLoadingDataItems = true
+
+        dataItemLoading = Task {
+            var offset = 0
+
+            while !Task.isCancelled {
+                let page = fetchDataItemPage(matching: nil, offset: offset)
+
+                addLoadedDataItems(page)
+
+                if page.count < DataController.dataItemPageSize { break }
+
+                offset += page.count
+
+                // Input and drawing are handled between pages
+                await Task.yield()
+            }
+
+            if Task.isCancelled { return }
+
+            addSkippedDataItems()
+
+            isLoadingDataItems = false
+        }
+    }
+
+
+    /// Fetches the Data Items inside the Nodes and all of their sub Nodes ahead of the pages.
+    ///
+    /// The first page is fetched right away so the selection shows Data Items immediately.  The remaining pages are fetched like the other pages, yielding between them, and are cancelled by the next selection.
+    func loadDataItems(inSubtreesOf nodes: [Node]) {
+        subtreeDataItemLoading?.cancel()
+        subtreeDataItemLoading = nil
+
+        var nodeIDs: [Node.ID] = []
+
+        for nextNode in nodes {
+            nodeIDs.append(nextNode.id)
+            nodeIDs.append(contentsOf: subtreeIndex.subNodeIDs(inSubtreeOf: nextNode.id))
+        }
+
+        // The predicate filters on the stored local ID of the Node, because the persistent identifier isn't a stored attribute the store can compare
+        let nodeUUIDs = nodeIDs.compactMap { nodesByID[$0]?.localID.id }
+
+        if nodeUUIDs.isEmpty { return }
+
+        let predicate = #Predicate<DataItem> { nextDataItem in
+            nextDataItem.node.flatMap { nodeUUIDs.contains($0.localID.id) } ?? false
+        }
+
+        let firstPage = fetchDataItemPage(matching: predicate, offset: 0)
+
+        addLoadedDataItems(firstPage)
+
+        if firstPage.count < DataController.dataItemPageSize { return }
+
+        subtreeDataItemLoading = Task {
+            var offset = firstPage.count
+
+            while !Task.isCancelled {
+                await Task.yield()
+
+                if Task.isCancelled { return }
+
+                let page = fetchDataItemPage(matching: predicate, offset: offset)
+
+                addLoadedDataItems(page)
+
+                if page.count < DataController.dataItemPageSize { break }
+
+                offset += page.count
+            }
+        }
+    }
+
+
+    private func fetchDataItemPage(matching predicate: Predicate<DataItem>?, offset: Int) -> [DataItem] {
+        var descriptor = FetchDescriptor<DataItem>(predicate: predicate, sortBy: [SortDescriptor(\.creationDate)])
+        descriptor.fetchOffset = offset
+        descriptor.fetchLimit = DataController.dataItemPageSize
+        descriptor.propertiesToFetch = DataController.dataItemPropertiesToFetch
+        descriptor.relationshipKeyPathsForPrefetching = [\.node]
+
+        do {
+            return try modelContext.fetch(descriptor)
+        } catch {
+            Logger.dataController.error("DataController: Failed to Fetch DataItems at offset \(offset): \(error)")
+            return []
+        }
+    }
+
+
+    /// Adds the Data Items that aren't in the indices yet.  To the indices a loaded Data Item is the same as an inserted one.
+    private func addLoadedDataItems(_ dataItems: [DataItem]) {
+        let newDataItems = dataItems.filter { dataItemsByID[$0.id] == nil }
+
+        apply(ModelChanges(insertedDataItems: newDataItems))
+    }
+
+
+    /// Data Items deleted while the pages were fetched move the later Data Items to earlier pages, so the Data Items that were skipped are fetched by their identifiers.
+    private func addSkippedDataItems() {
+        do {
+            let identifiers = try modelContext.fetchIdentifiers(FetchDescriptor<DataItem>())
+
+            if identifiers.count == dataItemsByID.count { return }
+
+            let skippedDataItems = identifiers
+                .filter { dataItemsByID[$0] == nil }
+                .compactMap { modelContext.model(for: $0) as? DataItem }
+
+            addLoadedDataItems(skippedDataItems)
+        } catch {
+            Logger.dataController.error("DataController: Failed to Fetch DataItem identifiers: \(error)")
+        }
+    }
+}
@@ -0,0 +1,103 @@
+//
+//  DataItemSearchIndex.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// Search index for the filter of the data list.
+///
+/// Matches the same fields as `DataItem.containsFilter(_:)`.  The name, URL and notes of each Data Item are indexed with the Data Item, while the folder path and notes of each Node are indexed once with the Node.  A Data Item matches if its own text matches or if its Node matches, so renaming a folder re-indexes the Nodes below it rather than every Data Item below it.
+@MainActor
+final class DataItemSearchIndex {
+    private var dataItems = TrigramIndex<DataItem.ID>()
+
+    private var nodes = TrigramIndex<Node.ID>()
+
+
+
+    // MARK: - Building
+    func rebuild(nodes: [Node], dataItems: [DataItem]) {
+        self.nodes.removeAll()
+        self.dataItems.removeAll()
+
+        for nextNode in nodes {
+            self.nodes.update(nextNode.id, text: DataItemSearchIndex.text(of: nextNode))
+        }
+
+        for nextDataItem in dataItems {
+            self.dataItems.update(nextDataItem.id, text: DataItemSearchIndex.text(of: nextDataItem))
+        }
+    }
+
+
+    func apply(_ changes: ModelChanges) {
+        for nextID in changes.deletedNodeIDs {
+            nodes.remove(nextID)
+        }
+
+        for nextID in changes.deletedDataItemIDs {
+            dataItems.remove(nextID)
+        }
+
+        for nextDataItem in changes.insertedDataItems + changes.editedDataItems {
+            dataItems.update(nextDataItem.id, text: DataItemSearchIndex.text(of: nextDataItem))
+        }
+
+        for nextNode in changes.insertedNodes {
+            nodes.update(nextNode.id, text: DataItemSearchIndex.text(of: nextNode))
+        }
+
+        // The folder path of every Node below a moved or renamed Node changes
+        for nextNode in changes.movedNodes + changes.editedNodes {
+            nodes.update(nextNode.id, text: DataItemSearchIndex.text(of: nextNode))
+
+            for nextSubNode in nextNode.flattendSubNodes() {
+                nodes.update(nextSubNode.id, text: DataItemSearchIndex.text(of: nextSubNode))
+            }
+        }
+    }
+
+
+
+    // MARK: - Querying
+    /// IDs of the Data Items that match `filter`.
+    ///
+    /// - Parameter subtreeIndex: Used to find the Data Items directly in the matching Nodes.
+    func dataItemIDs(matching filter: String, subtreeIndex: NodeSubtreeIndex) -> Set<DataItem.ID> {
+        var output = Set(dataItems.keys(matching: filter))
+
+        for nextNodeID in nodes.keys(matching: filter) {
+            output.formUnion(subtreeIndex.dataItemIDs(directlyIn: nextNodeID))
+        }
+
+        return output
+    }
+
+
+    /// True if the Data Item matches `filter`.  Used for the few Data Items changed by a mutation.
+    func dataItem(_ dataItem: DataItem, matches filter: String) -> Bool {
+        if dataItems.contains(dataItem.id, filter) { return true }
+
+        guard let nodeID = dataItem.node?.id else { return false }
+
+        return nodes.contains(nodeID, filter)
+    }
+
+
+
+    // MARK: - Indexed Text
+    // Fields are separated by new lines so that a filter can't match across two fields
+    private static func text(of dataItem: DataItem) -> String {
+        [dataItem.name, dataItem.url.absoluteString, dataItem.userNotes].joined(separator: "\n")
+    }
+
+
+    private static func text(of node: Node) -> String {
+        [NodePathCache.shared.path(of: node) ?? "", node.userNotes].joined(separator: "\n")
+    }
+}
@@ -0,0 +1,285 @@
+//
+//  EffectiveSettingsResolver.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// Caches the Parser Settings and Graph Template that each Node and Data Item uses after inheritance.
+///
+/// `getAssociatedParserSettings()` and `getAssociatedGraphTemplate()` walk up the Node parents on every call.  The resolver walks them once and remembers the result for every Node on the way.
+///
+/// When a setting is assigned, the `...DidChange(on:)` methods invalidate the Node and the part of its subtree that inherits from it, and return the IDs of exactly the Data Items whose effective setting may have changed.  Sub Nodes and Data Items with their own setting are skipped.
+///
+/// The resolver also keeps the reverse mapping, from Parser Settings and Graph Templates to the resolved Data Items that use them.  Tracked Data Items (those with loaded ProcessedData) are resolved again as soon as they are invalidated, so the reverse mapping always covers them.
+///
+/// Example Usage
+///```swift
+/// let parserSettings = EffectiveSettingsResolver.shared.parserSettings(for: dataItem)
+/// ```
+@MainActor
+final class EffectiveSettingsResolver {
+    static let shared = EffectiveSettingsResolver()
+
+    // A nil value means the Node or Data Item resolves to no setting
+    private var parserSettingsOfNodes: [Node.ID : ParserSettings?] = [:]
+    private var parserSettingsOfDataItems: [DataItem.ID : ParserSettings?] = [:]
+
+    private var graphTemplatesOfNodes: [Node.ID : GraphTemplate?] = [:]
+    private var graphTemplatesOfDataItems: [DataItem.ID : GraphTemplate?] = [:]
+
+    // Reverse mapping of the resolved Data Items
+    private var dataItemIDsByParserSettings: [ParserSettings.LocalID : Set<DataItem.ID>] = [:]
+    private var dataItemIDsByGraphTemplate: [GraphTemplate.LocalID : Set<DataItem.ID>] = [:]
+
+    private var trackedDataItems: [DataItem.ID : DataItem] = [:]
+
+
+
+    // MARK: - Parser Settings
+    func parserSettings(for dataItem: DataItem) -> ParserSettings? {
+        if let cached = parserSettingsOfDataItems[dataItem.id] { return cached }
+
+        let resolved: ParserSettings?
+
+        switch dataItem.parserSettingsInputType {
+        case .none: resolved = nil
+        case .directlySet: resolved = dataItem.parserSettings
+        case .defaultFromParent: resolved = dataItem.node.flatMap { parserSettings(for: $0) }
+        }
+
+        parserSettingsOfDataItems[dataItem.id] = .some(resolved)
+
+        if let resolved {
+            dataItemIDsByParserSettings[resolved.localID, default: []].insert(dataItem.id)
+        }
+
+        return resolved
+    }
+
+
+    func parserSettings(for node: Node) -> ParserSettings? {
+        if let cached = parserSettingsOfNodes[node.id] { return cached }
+
+        let resolved: ParserSettings?
+
+        switch node.parserSettingsInputType {
+        case .none: resolved = nil
+        case .directlySet: resolved = node.parserSettings
+        case .defaultFromParent: resolved = node.parent.flatMap { parserSettings(for: $0) }
+        }
+
+        parserSettingsOfNodes[node.id] = .some(resolved)
+
+        return resolved
+    }
+
+
+    /// Invalidates the Data Item and returns its ID.
+    func parserSettingsDidChange(on dataItem: DataItem) -> [DataItem.ID] {
+        removeParserSettings(ofDataItemWith: dataItem.id)
+        resolveTrackedDataItems([dataItem.id])
+
+        return [dataItem.id]
+    }
+
+
+    /// Invalidates the Node and everything below it that inherits its Parser Settings.
+    ///
+    /// - Returns: IDs of the Data Items that inherit their Parser Settings from the Node.
+    func parserSettingsDidChange(on node: Node) -> [DataItem.ID] {
+        var affectedDataItemIDs: [DataItem.ID] = []
+
+        var pending = [node]
+
+        while let nextNode = pending.popLast() {
+            parserSettingsOfNodes.removeValue(forKey: nextNode.id)
+
+            for nextDataItem in nextNode.dataItems where nextDataItem.parserSettingsInputType == .defaultFromParent {
+                removeParserSettings(ofDataItemWith: nextDataItem.id)
+                affectedDataItemIDs.append(nextDataItem.id)
+            }
+
+            pending.append(contentsOf: nextNode.unsortedSubNodes.filter { $0.parserSettingsInputType == .defaultFromParent })
+        }
+
+        resolveTrackedDataItems(affectedDataItemIDs)
+
+        return affectedDataItemIDs
+    }
+
+
+
+    // MARK: - Graph Templates
+    func graphTemplate(for dataItem: DataItem) -> GraphTemplate? {
+        if let cached = graphTemplatesOfDataItems[dataItem.id] { return cached }
+
+        let resolved: GraphTemplate?
+
+        switch dataItem.graphTemplateInputType {
+        case .none: resolved = nil
+        case .directlySet: resolved = dataItem.graphTemplate
+        case .defaultFromParent: resolved = dataItem.node.flatMap { graphTemplate(for: $0) }
+        }
+
+        graphTemplatesOfDataItems[dataItem.id] = .some(resolved)
+
+        if let resolved {
+            dataItemIDsByGraphTemplate[resolved.localID, default: []].insert(dataItem.id)
+        }
+
+        return resolved
+    }
+
+
+    func graphTemplate(for node: Node) -> GraphTemplate? {
+        if let cached = graphTemplatesOfNodes[node.id] { return cached }
+
+        let resolved: GraphTemplate?
+
+        switch node.graphTemplateInputType {
+        case .none: resolved = nil
+        case .directlySet: resolved = node.graphTemplate
+        case .defaultFromParent: resolved = node.parent.flatMap { graphTemplate(for: $0) }
+        }
+
+        graphTemplatesOfNodes[node.id] = .some(resolved)
+
+        return resolved
+    }
+
+
+    /// Invalidates the Data Item and returns its ID.
+    func graphTemplateDidChange(on dataItem: DataItem) -> [DataItem.ID] {
+        removeGraphTemplate(ofDataItemWith: dataItem.id)
+        resolveTrackedDataItems([dataItem.id])
+
+        return [dataItem.id]
+    }
+
+
+    /// Invalidates the Node and everything below it that inherits its Graph Template.
+    ///
+    /// - Returns: IDs of the Data Items that inherit their Graph Template from the Node.
+    func graphTemplateDidChange(on node: Node) -> [DataItem.ID] {
+        var affectedDataItemIDs: [DataItem.ID] = []
+
+        var pending = [node]
+
+        while let nextNode = pending.popLast() {
+            graphTemplatesOfNodes.removeValue(forKey: nextNode.id)
+
+            for nextDataItem in nextNode.dataItems where nextDataItem.graphTemplateInputType == .defaultFromParent {
+                removeGraphTemplate(ofDataItemWith: nextDataItem.id)
+                affectedDataItemIDs.append(nextDataItem.id)
+            }
+
+            pending.append(contentsOf: nextNode.unsortedSubNodes.filter { $0.graphTemplateInputType == .defaultFromParent })
+        }
+
+        resolveTrackedDataItems(affectedDataItemIDs)
+
+        return affectedDataItemIDs
+    }
+
+
+
+    // MARK: - Applying Changes
+    /// Invalidates the models whose ancestors changed.
+    ///
+    /// Deleting a Node, Parser Settings or a Graph Template clears the whole cache.  Deletes are rare and the cleared entries are resolved again on demand.
+    func apply(_ changes: ModelChanges) {
+        for nextID in changes.deletedDataItemIDs {
+            trackedDataItems.removeValue(forKey: nextID)
+        }
+
+        if !changes.deletedNodeIDs.isEmpty || !changes.deletedParserSettingsIDs.isEmpty || !changes.deletedGraphTemplateIDs.isEmpty {
+            removeAll()
+            return
+        }
+
+        for nextNode in changes.movedNodes {
+            _ = parserSettingsDidChange(on: nextNode)
+            _ = graphTemplateDidChange(on: nextNode)
+        }
+
+        for nextDataItem in changes.movedDataItems {
+            _ = parserSettingsDidChange(on: nextDataItem)
+            _ = graphTemplateDidChange(on: nextDataItem)
+        }
+
+        for nextID in changes.deletedDataItemIDs {
+            removeParserSettings(ofDataItemWith: nextID)
+            removeGraphTemplate(ofDataItemWith: nextID)
+        }
+    }
+
+
+    /// Clears the cache and resolves the tracked Data Items again.
+    func removeAll() {
+        parserSettingsOfNodes.removeAll()
+        parserSettingsOfDataItems.removeAll()
+        graphTemplatesOfNodes.removeAll()
+        graphTemplatesOfDataItems.removeAll()
+
+        dataItemIDsByParserSettings.removeAll()
+        dataItemIDsByGraphTemplate.removeAll()
+
+        resolveTrackedDataItems(trackedDataItems.keys)
+    }
+
+
+    private func removeParserSettings(ofDataItemWith id: DataItem.ID) {
+        guard case let cached?? = parserSettingsOfDataItems.removeValue(forKey: id) else { return }
+
+        dataItemIDsByParserSettings[cached.localID]?.remove(id)
+    }
+
+
+    private func removeGraphTemplate(ofDataItemWith id: DataItem.ID) {
+        guard case let cached?? = graphTemplatesOfDataItems.removeValue(forKey: id) else { return }
+
+        dataItemIDsByGraphTemplate[cached.localID]?.remove(id)
+    }
+
+
+
+    // MARK: - Reverse Lookup
+    /// Keeps the Data Item resolved so that the reverse lookups always include it.
+    func track(_ dataItem: DataItem) {
+        trackedDataItems[dataItem.id] = dataItem
+        _ = parserSettings(for: dataItem)
+        _ = graphTemplate(for: dataItem)
+    }
+
+
+    func untrack(_ dataItemID: DataItem.ID) {
+        trackedDataItems.removeValue(forKey: dataItemID)
+    }
+
+
+    /// IDs of the resolved Data Items that use the Parser Settings, including every tracked Data Item.
+    func dataItemIDs(usingParserSettings parserSettingsID: ParserSettings.LocalID) -> Set<DataItem.ID> {
+        dataItemIDsByParserSettings[parserSettingsID] ?? []
+    }
+
+
+    /// IDs of the resolved Data Items that use the Graph Template, including every tracked Data Item.
+    func dataItemIDs(usingGraphTemplate graphTemplateID: GraphTemplate.LocalID) -> Set<DataItem.ID> {
+        dataItemIDsByGraphTemplate[graphTemplateID] ?? []
+    }
+
+
+    private func resolveTrackedDataItems(_ ids: some Sequence<DataItem.ID>) {
+        for nextID in ids {
+            guard let nextDataItem = trackedDataItems[nextID] else { continue }
+
+            _ = parserSettings(for: nextDataItem)
+            _ = graphTemplate(for: nextDataItem)
+        }
+    }
+}
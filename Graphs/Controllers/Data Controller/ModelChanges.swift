@@ -0,0 +1,89 @@
+//
+//  ModelChanges.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// The models changed by a mutation.
+///
+/// Mutations of the DataController describe what they changed with ModelChanges and `DataController.apply(_:)` patches the fetched models with it, so the cost of a mutation scales with the size of the change rather than the size of the library.
+///
+/// Inserted models must be saved before they are applied.  The indices are keyed by `persistentModelID`, which is temporary until the first save.
+///
+/// Example Usage
+///```swift
+/// modelContext.insert(newNode)
+/// try? modelContext.save()
+/// apply(ModelChanges(insertedNodes: [newNode]))
+/// ```
+struct ModelChanges {
+    var insertedNodes: [Node] = []
+    var deletedNodeIDs: Set<Node.ID> = []
+
+    /// Nodes whose parent changed.
+    var movedNodes: [Node] = []
+
+    /// Nodes whose name or notes changed.
+    var editedNodes: [Node] = []
+
+    var insertedDataItems: [DataItem] = []
+    var deletedDataItemIDs: Set<DataItem.ID> = []
+
+    /// Data Items whose Node changed.
+    var movedDataItems: [DataItem] = []
+
+    /// Data Items whose name or notes changed.
+    var editedDataItems: [DataItem] = []
+
+    var insertedParserSettings: [ParserSettings] = []
+    var deletedParserSettingsIDs: Set<ParserSettings.ID> = []
+
+    var insertedGraphTemplates: [GraphTemplate] = []
+    var deletedGraphTemplateIDs: Set<GraphTemplate.ID> = []
+
+    var insertedFileExtensions: [FileExtension] = []
+    var deletedFileExtensionIDs: Set<FileExtension.ID> = []
+
+
+    var isEmpty: Bool {
+        insertedNodes.isEmpty && deletedNodeIDs.isEmpty && movedNodes.isEmpty && editedNodes.isEmpty
+        && insertedDataItems.isEmpty && deletedDataItemIDs.isEmpty && movedDataItems.isEmpty && editedDataItems.isEmpty
+        && insertedParserSettings.isEmpty && deletedParserSettingsIDs.isEmpty
+        && insertedGraphTemplates.isEmpty && deletedGraphTemplateIDs.isEmpty
+        && insertedFileExtensions.isEmpty && deletedFileExtensionIDs.isEmpty
+    }
+
+
+    /// True if a Node was inserted, deleted, moved or edited.
+    var changesNodes: Bool {
+        !insertedNodes.isEmpty || !deletedNodeIDs.isEmpty || !movedNodes.isEmpty || !editedNodes.isEmpty
+    }
+
+
+    /// Adds the changes of `other` to these changes.
+    mutating func formUnion(_ other: ModelChanges) {
+        insertedNodes.append(contentsOf: other.insertedNodes)
+        deletedNodeIDs.formUnion(other.deletedNodeIDs)
+        movedNodes.append(contentsOf: other.movedNodes)
+        editedNodes.append(contentsOf: other.editedNodes)
+
+        insertedDataItems.append(contentsOf: other.insertedDataItems)
+        deletedDataItemIDs.formUnion(other.deletedDataItemIDs)
+        movedDataItems.append(contentsOf: other.movedDataItems)
+        editedDataItems.append(contentsOf: other.editedDataItems)
+
+        insertedParserSettings.append(contentsOf: other.insertedParserSettings)
+        deletedParserSettingsIDs.formUnion(other.deletedParserSettingsIDs)
+
+        insertedGraphTemplates.append(contentsOf: other.insertedGraphTemplates)
+        deletedGraphTemplateIDs.formUnion(other.deletedGraphTemplateIDs)
+
+        insertedFileExtensions.append(contentsOf: other.insertedFileExtensions)
+        deletedFileExtensionIDs.formUnion(other.deletedFileExtensionIDs)
+    }
+}
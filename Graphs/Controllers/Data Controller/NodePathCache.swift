@@ -0,0 +1,63 @@
+//
+//  NodePathCache.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// Caches the folder path of each Node.
+///
+/// `Node.nodePath()` rebuilds the path from every parent on each call, which the data list does for every comparison when it is sorted by folder.  Paths are built from the cached path of the parent and dropped by `apply(_:)` when a Node above them is moved or renamed.
+@MainActor
+final class NodePathCache {
+    static let shared = NodePathCache()
+
+    // A nil value means the Node has no path (it is a root Node)
+    private var paths: [Node.ID : String?] = [:]
+
+
+    /// Same as `node.nodePath()`.
+    func path(of node: Node) -> String? {
+        if let cached = paths[node.id] { return cached }
+
+        let path: String?
+
+        if let parent = node.parent {
+            if let parentPath = self.path(of: parent) {
+                path = parentPath + "\\" + node.name
+            } else {
+                path = node.name
+            }
+        } else {
+            path = nil
+        }
+
+        paths[node.id] = .some(path)
+
+        return path
+    }
+
+
+    func apply(_ changes: ModelChanges) {
+        for nextID in changes.deletedNodeIDs {
+            paths.removeValue(forKey: nextID)
+        }
+
+        for nextNode in changes.movedNodes + changes.editedNodes {
+            paths.removeValue(forKey: nextNode.id)
+
+            for nextSubNode in nextNode.flattendSubNodes() {
+                paths.removeValue(forKey: nextSubNode.id)
+            }
+        }
+    }
+
+
+    func removeAll() {
+        paths.removeAll()
+    }
+}
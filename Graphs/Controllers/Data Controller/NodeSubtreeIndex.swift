@@ -0,0 +1,198 @@
+//
+//  NodeSubtreeIndex.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// The Node tree stored as IDs, with a cached set of the Data Items below each Node.
+///
+/// The cached sets are built on first use from the sets of the sub Nodes, so resolving any subtree is linear in the size of the tree the first time and a lookup afterwards.  The index is patched by `apply(_:)` with the same ModelChanges as the DataController, which drops the cached sets of the changed Nodes and their ancestors only.
+///
+/// Because the index keeps its own parent links, the old ancestors of a moved or deleted model are known even after SwiftData has changed or deleted it.
+@MainActor
+final class NodeSubtreeIndex {
+    private var parentIDs: [Node.ID : Node.ID] = [:]
+
+    private var subNodeIDs: [Node.ID : Set<Node.ID>] = [:]
+
+    /// Data Items directly inside each Node.
+    private var dataItemIDs: [Node.ID : Set<DataItem.ID>] = [:]
+
+    private var nodeIDsOfDataItems: [DataItem.ID : Node.ID] = [:]
+
+    /// Data Items inside each Node and all of its sub Nodes.
+    ///
+    /// If a Node has a cached set, so does every Node below it.  Invalidation relies on this to stop at the first Node without a cached set.
+    private var subtreeDataItemIDs: [Node.ID : Set<DataItem.ID>] = [:]
+
+
+
+    // MARK: - Building
+    /// Replaces the index with the tree formed by `nodes` and `dataItems`.
+    func rebuild(nodes: [Node], dataItems: [DataItem]) {
+        parentIDs = [:]
+        subNodeIDs = [:]
+        dataItemIDs = [:]
+        nodeIDsOfDataItems = [:]
+        subtreeDataItemIDs = [:]
+
+        for nextNode in nodes {
+            insertNode(nextNode.id, parentID: nextNode.parent?.id)
+        }
+
+        for nextDataItem in dataItems {
+            guard let nodeID = nextDataItem.node?.id else { continue }
+            insertDataItem(nextDataItem.id, nodeID: nodeID)
+        }
+    }
+
+
+
+    // MARK: - Applying Changes
+    func apply(_ changes: ModelChanges) {
+
+        // Deleted Nodes and their Data Items.  Sub Nodes of a deleted Node are listed with it.
+        for nextID in changes.deletedNodeIDs {
+            invalidate(nextID)
+
+            if let parentID = parentIDs.removeValue(forKey: nextID) {
+                subNodeIDs[parentID]?.remove(nextID)
+            }
+
+            subNodeIDs.removeValue(forKey: nextID)
+
+            // The Data Items are kept without a Node
+            for nextDataItemID in dataItemIDs.removeValue(forKey: nextID) ?? [] {
+                nodeIDsOfDataItems.removeValue(forKey: nextDataItemID)
+            }
+        }
+
+        for nextID in changes.deletedDataItemIDs {
+            removeDataItem(nextID)
+        }
+
+
+        // Inserted Nodes and Data Items
+        for nextNode in changes.insertedNodes {
+            insertNode(nextNode.id, parentID: nextNode.parent?.id)
+        }
+
+        for nextDataItem in changes.insertedDataItems {
+            guard let nodeID = nextDataItem.node?.id else { continue }
+            insertDataItem(nextDataItem.id, nodeID: nodeID)
+        }
+
+
+        // Moved Nodes and Data Items
+        for nextNode in changes.movedNodes {
+            invalidate(nextNode.id)
+
+            if let oldParentID = parentIDs.removeValue(forKey: nextNode.id) {
+                subNodeIDs[oldParentID]?.remove(nextNode.id)
+            }
+
+            if let newParentID = nextNode.parent?.id {
+                parentIDs[nextNode.id] = newParentID
+                subNodeIDs[newParentID, default: []].insert(nextNode.id)
+                invalidate(newParentID)
+            }
+        }
+
+        for nextDataItem in changes.movedDataItems {
+            removeDataItem(nextDataItem.id)
+
+            guard let nodeID = nextDataItem.node?.id else { continue }
+            insertDataItem(nextDataItem.id, nodeID: nodeID)
+        }
+    }
+
+
+    private func insertNode(_ nodeID: Node.ID, parentID: Node.ID?) {
+        guard let parentID else { return }
+
+        parentIDs[nodeID] = parentID
+        subNodeIDs[parentID, default: []].insert(nodeID)
+        invalidate(parentID)
+    }
+
+
+    private func insertDataItem(_ dataItemID: DataItem.ID, nodeID: Node.ID) {
+        nodeIDsOfDataItems[dataItemID] = nodeID
+        dataItemIDs[nodeID, default: []].insert(dataItemID)
+        invalidate(nodeID)
+    }
+
+
+    private func removeDataItem(_ dataItemID: DataItem.ID) {
+        guard let nodeID = nodeIDsOfDataItems.removeValue(forKey: dataItemID) else { return }
+
+        dataItemIDs[nodeID]?.remove(dataItemID)
+        invalidate(nodeID)
+    }
+
+
+    /// Drops the cached sets of the Node and its ancestors.
+    private func invalidate(_ nodeID: Node.ID) {
+        var nextID: Node.ID? = nodeID
+
+        while let id = nextID, subtreeDataItemIDs.removeValue(forKey: id) != nil {
+            nextID = parentIDs[id]
+        }
+    }
+
+
+
+    // MARK: - Lookup
+    /// IDs of the Data Items inside the Node and all of its sub Nodes.
+    func dataItemIDs(inSubtreeOf nodeID: Node.ID) -> Set<DataItem.ID> {
+        if let cached = subtreeDataItemIDs[nodeID] { return cached }
+
+        var output = dataItemIDs[nodeID] ?? []
+
+        for nextSubNodeID in subNodeIDs[nodeID] ?? [] {
+            output.formUnion(dataItemIDs(inSubtreeOf: nextSubNodeID))
+        }
+
+        subtreeDataItemIDs[nodeID] = output
+
+        return output
+    }
+
+
+    /// IDs of the Data Items directly inside the Node.
+    func dataItemIDs(directlyIn nodeID: Node.ID) -> Set<DataItem.ID> {
+        dataItemIDs[nodeID] ?? []
+    }
+
+
+    /// IDs of every Node below the Node, not including the Node itself.
+    func subNodeIDs(inSubtreeOf nodeID: Node.ID) -> [Node.ID] {
+        var output: [Node.ID] = []
+        var pending = Array(subNodeIDs[nodeID] ?? [])
+
+        while let nextID = pending.popLast() {
+            output.append(nextID)
+            pending.append(contentsOf: subNodeIDs[nextID] ?? [])
+        }
+
+        return output
+    }
+
+
+    /// True if `nodeID` is one of `ancestorIDs` or is below one of them.
+    func isNode(_ nodeID: Node.ID, inSubtreeOfAny ancestorIDs: Set<Node.ID>) -> Bool {
+        var nextID: Node.ID? = nodeID
+
+        while let id = nextID {
+            if ancestorIDs.contains(id) { return true }
+            nextID = parentIDs[id]
+        }
+
+        return false
+    }
+}
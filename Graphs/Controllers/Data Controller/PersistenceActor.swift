@@ -0,0 +1,253 @@
+//
+//  PersistenceActor.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+import SwiftData
+
+
+/// Performs bulk SwiftData mutations on its own ModelContext so they don't block the main actor.
+///
+/// Models are passed in and out as PersistentIdentifiers.  Changes are saved in batches of `saveBatchSize` models or every `saveInterval`, whichever comes first, and each save is reported with a Batch so the DataController can merge it into the main context and update its progress while the operation continues.
+///
+/// - Note: Only mutations that don't post notifications belong here.  Setting Parser Settings or Graph Templates posts notifications from the models that have to be handled on the main actor.
+@ModelActor
+actor PersistenceActor {
+
+    static let saveBatchSize = 500
+
+    static let saveInterval: Duration = .milliseconds(500)
+
+
+    /// Models changed by one save.
+    struct Batch: Sendable {
+        var insertedNodeIDs: [PersistentIdentifier] = []
+        var insertedDataItemIDs: [PersistentIdentifier] = []
+        var deletedNodeIDs: [PersistentIdentifier] = []
+        var deletedDataItemIDs: [PersistentIdentifier] = []
+        var movedNodeIDs: [PersistentIdentifier] = []
+        var movedDataItemIDs: [PersistentIdentifier] = []
+
+        var count: Int {
+            insertedNodeIDs.count + insertedDataItemIDs.count + deletedNodeIDs.count + deletedDataItemIDs.count + movedNodeIDs.count + movedDataItemIDs.count
+        }
+    }
+
+
+    typealias BatchHandler = @Sendable (Batch) async -> Void
+
+
+    /// Accumulates changes and saves them by count and by time.
+    ///
+    /// Inserted models are kept as models because their identifiers only become permanent once they are saved.
+    private struct BatchSaver {
+        var batch = Batch()
+        var insertedNodes: [Node] = []
+        var insertedDataItems: [DataItem] = []
+        var lastSave = ContinuousClock.now
+
+        var count: Int {
+            batch.count + insertedNodes.count + insertedDataItems.count
+        }
+
+        var isDue: Bool {
+            count >= PersistenceActor.saveBatchSize || lastSave.duration(to: .now) >= PersistenceActor.saveInterval
+        }
+    }
+
+
+
+    // MARK: - Importing
+    /// Graph Templates and Parser Settings found while importing.  They are imported on the main actor because they may ask the user what to do.
+    struct ImportResult: Sendable {
+        var topLevelNodeIDs: [PersistentIdentifier] = []
+        var graphTemplateURLs: [(url: URL, nodeID: PersistentIdentifier)] = []
+        var parserSettingsURLs: [(url: URL, nodeID: PersistentIdentifier)] = []
+    }
+
+
+    /// Inserts a Node for every scanned directory and a Data Item for every scanned data file.
+    ///
+    /// - Parameter parentID: Node that the top level directories are inserted into, or nil for new root Nodes.
+    func insert(_ directories: [DirectoryScanner.Directory], intoNodeWith parentID: PersistentIdentifier?, didSave: @escaping BatchHandler) async throws -> ImportResult {
+
+        return try await rollingBackOnError {
+            let parentNode: Node? = parentID.flatMap { self[$0, as: Node.self] }
+
+            var topLevelNodes: [Node] = []
+            var graphTemplateURLs: [(url: URL, node: Node)] = []
+            var parserSettingsURLs: [(url: URL, node: Node)] = []
+
+            var saver = BatchSaver()
+
+            var pending: [(directory: DirectoryScanner.Directory, parent: Node?)] = directories.reversed().map { ($0, parentNode) }
+
+            while let (nextDirectory, nextParent) = pending.popLast() {
+                try Task.checkCancellation()
+
+                let newNode = Node(url: nextDirectory.url)
+                modelContext.insert(newNode)
+                newNode.postModelContextInsertInitialization(nextParent)
+
+                saver.insertedNodes.append(newNode)
+                if nextParent === parentNode { topLevelNodes.append(newNode) }
+
+                for nextFile in nextDirectory.dataFiles {
+                    let newDataItem = DataItem(url: nextFile.url, bookmarkData: nextFile.bookmarkData)
+                    modelContext.insert(newDataItem)
+                    newDataItem.postModelContextInsertInitialization(newNode)
+
+                    saver.insertedDataItems.append(newDataItem)
+                }
+
+                graphTemplateURLs.append(contentsOf: nextDirectory.graphTemplateURLs.map { ($0, newNode) })
+                parserSettingsURLs.append(contentsOf: nextDirectory.parserSettingsURLs.map { ($0, newNode) })
+
+                pending.append(contentsOf: nextDirectory.subdirectories.reversed().map { ($0, newNode) })
+
+                if saver.isDue {
+                    try await save(&saver, didSave: didSave)
+                }
+            }
+
+            try await save(&saver, didSave: didSave)
+
+            return ImportResult(topLevelNodeIDs: topLevelNodes.map { $0.persistentModelID },
+                                graphTemplateURLs: graphTemplateURLs.map { ($0.url, $0.node.persistentModelID) },
+                                parserSettingsURLs: parserSettingsURLs.map { ($0.url, $0.node.persistentModelID) })
+        }
+    }
+
+
+
+    // MARK: - Deleting
+    /// Deletes the Nodes and everything below them, deepest Nodes first, so the work is split into batches instead of one cascade.
+    ///
+    /// Data Items of deleted Nodes are kept (the Node relationship is nullified), as with a single delete.
+    func deleteNodes(_ nodeIDs: [PersistentIdentifier], didSave: @escaping BatchHandler) async throws {
+        try await rollingBackOnError {
+            var saver = BatchSaver()
+
+            for nextID in nodeIDs {
+                guard let nextNode = self[nextID, as: Node.self] else { continue }
+
+                for nextSubNode in nextNode.flattendSubNodes().reversed() + [nextNode] {
+                    try Task.checkCancellation()
+
+                    saver.batch.deletedNodeIDs.append(nextSubNode.persistentModelID)
+                    modelContext.delete(nextSubNode)
+
+                    if saver.isDue {
+                        try await save(&saver, didSave: didSave)
+                    }
+                }
+            }
+
+            try await save(&saver, didSave: didSave)
+        }
+    }
+
+
+    func deleteDataItems(_ dataItemIDs: [PersistentIdentifier], didSave: @escaping BatchHandler) async throws {
+        try await rollingBackOnError {
+            var saver = BatchSaver()
+
+            for nextID in dataItemIDs {
+                try Task.checkCancellation()
+
+                guard let nextDataItem = self[nextID, as: DataItem.self] else { continue }
+
+                saver.batch.deletedDataItemIDs.append(nextID)
+                modelContext.delete(nextDataItem)
+
+                if saver.isDue {
+                    try await save(&saver, didSave: didSave)
+                }
+            }
+
+            try await save(&saver, didSave: didSave)
+        }
+    }
+
+
+
+    // MARK: - Moving
+    /// Moves Nodes and Data Items into `targetID`.
+    ///
+    /// Nodes whose parent is also being moved stay with their parent, and Data Items that are already in the target are skipped.
+    func move(dataItemIDs: [PersistentIdentifier], nodeIDs: [PersistentIdentifier], to targetID: PersistentIdentifier, didSave: @escaping BatchHandler) async throws {
+
+        try await rollingBackOnError {
+            guard let targetNode = self[targetID, as: Node.self] else { return }
+
+            var saver = BatchSaver()
+
+            let movingNodeIDs = Set(nodeIDs)
+
+            for nextID in nodeIDs {
+                try Task.checkCancellation()
+
+                guard let nextNode = self[nextID, as: Node.self] else { continue }
+
+                if let parentID = nextNode.parent?.persistentModelID, movingNodeIDs.contains(parentID) { continue }
+
+                nextNode.setParent(targetNode)
+                saver.batch.movedNodeIDs.append(nextID)
+
+                if saver.isDue {
+                    try await save(&saver, didSave: didSave)
+                }
+            }
+
+            for nextID in dataItemIDs {
+                try Task.checkCancellation()
+
+                guard let nextDataItem = self[nextID, as: DataItem.self] else { continue }
+
+                // Only move the DataItems that are in a Node and aren't already in the target Node
+                guard let currentNode = nextDataItem.node, currentNode.localID != targetNode.localID else { continue }
+
+                nextDataItem.node = targetNode
+                saver.batch.movedDataItemIDs.append(nextID)
+
+                if saver.isDue {
+                    try await save(&saver, didSave: didSave)
+                }
+            }
+
+            try await save(&saver, didSave: didSave)
+        }
+    }
+
+
+
+    // MARK: - Saving
+    /// Discards the unsaved changes of an operation that throws, e.g. because it was cancelled or a save failed, so they aren't saved with the next operation.
+    private func rollingBackOnError<T>(_ operation: () async throws -> T) async rethrows -> T {
+        do {
+            return try await operation()
+        } catch {
+            modelContext.rollback()
+            throw error
+        }
+    }
+
+
+    private func save(_ saver: inout BatchSaver, didSave: BatchHandler) async throws {
+        if saver.count == 0 { return }
+
+        try modelContext.save()
+
+        var savedBatch = saver.batch
+        savedBatch.insertedNodeIDs = saver.insertedNodes.map { $0.persistentModelID }
+        savedBatch.insertedDataItemIDs = saver.insertedDataItems.map { $0.persistentModelID }
+
+        saver = BatchSaver()
+
+        await didSave(savedBatch)
+    }
+}
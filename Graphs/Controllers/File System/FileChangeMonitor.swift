@@ -0,0 +1,284 @@
+//
+//  FileChangeMonitor.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// Watches the files of the imported Data Items and Graph Templates and reports the ones that change on disk.
+///
+/// Only the directories that contain an imported file are watched, collapsed to the topmost ones so that nested folders share a stream.  Changed paths are mapped back to their Data Items and Graph Templates (changes inside a Graph Template package count as a change of the package), collected for `coalescingDelay` so that a file that is saved in several steps is reported once, and passed to the delegate.
+///
+/// The monitor is rebuilt by `DataController.fetchAllObjects()` and patched by `DataController.apply(_:)`.
+@MainActor
+final class FileChangeMonitor {
+
+    var delegate: FileChangeMonitorDelegate?
+
+    /// Changes are reported once no further changes arrive within this delay.
+    static let coalescingDelay: Duration = .milliseconds(500)
+
+    // The same file can be imported into several Nodes, so a path can belong to several Data Items
+    private var dataItemIDsByPath: [String : Set<DataItem.ID>] = [:]
+    private var pathsOfDataItems: [DataItem.ID : String] = [:]
+    private var dataItemsByID: [DataItem.ID : DataItem] = [:]
+
+    private var graphTemplateIDsByPath: [String : Set<GraphTemplate.ID>] = [:]
+    private var pathsOfGraphTemplates: [GraphTemplate.ID : String] = [:]
+    private var graphTemplatesByID: [GraphTemplate.ID : GraphTemplate] = [:]
+
+    /// Number of watched files in each directory.
+    private var numberOfFilesInDirectories: [String : Int] = [:]
+
+    /// Set when a directory gains its first file or loses its last file.
+    private var didChangeDirectories = false
+
+    private var watcher: FileSystemWatcher!
+
+    private var pendingWatchUpdate: Task<Void, Never>?
+
+    // Changes waiting to be reported
+    private var pendingDataItems: [DataItem.ID : DataItem] = [:]
+    private var pendingGraphTemplates: [GraphTemplate.ID : GraphTemplate] = [:]
+    private var pendingReport: Task<Void, Never>?
+
+
+    init() {
+        watcher = FileSystemWatcher { [weak self] changes in
+            self?.receive(changes)
+        }
+    }
+
+
+
+    // MARK: - Building
+    func rebuild(dataItems: [DataItem], graphTemplates: [GraphTemplate]) {
+        dataItemIDsByPath = [:]
+        pathsOfDataItems = [:]
+        dataItemsByID = [:]
+        graphTemplateIDsByPath = [:]
+        pathsOfGraphTemplates = [:]
+        graphTemplatesByID = [:]
+        numberOfFilesInDirectories = [:]
+
+        for nextDataItem in dataItems {
+            insert(nextDataItem)
+        }
+
+        for nextGraphTemplate in graphTemplates {
+            insert(nextGraphTemplate)
+        }
+
+        scheduleWatchUpdate()
+    }
+
+
+    func apply(_ changes: ModelChanges) {
+        for nextID in changes.deletedDataItemIDs {
+            guard let path = pathsOfDataItems.removeValue(forKey: nextID) else { continue }
+
+            dataItemsByID.removeValue(forKey: nextID)
+            FileChangeMonitor.remove(nextID, atPath: path, from: &dataItemIDsByPath)
+            removeFile(atPath: path)
+        }
+
+        for nextID in changes.deletedGraphTemplateIDs {
+            guard let path = pathsOfGraphTemplates.removeValue(forKey: nextID) else { continue }
+
+            graphTemplatesByID.removeValue(forKey: nextID)
+            FileChangeMonitor.remove(nextID, atPath: path, from: &graphTemplateIDsByPath)
+            removeFile(atPath: path)
+        }
+
+        for nextDataItem in changes.insertedDataItems {
+            insert(nextDataItem)
+        }
+
+        for nextGraphTemplate in changes.insertedGraphTemplates {
+            insert(nextGraphTemplate)
+        }
+
+        if didChangeDirectories {
+            scheduleWatchUpdate()
+        }
+    }
+
+
+    private func insert(_ dataItem: DataItem) {
+        let path = dataItem.url.watchedPath
+
+        guard pathsOfDataItems.updateValue(path, forKey: dataItem.id) == nil else { return }
+
+        dataItemsByID[dataItem.id] = dataItem
+        dataItemIDsByPath[path, default: []].insert(dataItem.id)
+        addFile(atPath: path)
+    }
+
+
+    private func insert(_ graphTemplate: GraphTemplate) {
+        let path = graphTemplate.url.watchedPath
+
+        guard pathsOfGraphTemplates.updateValue(path, forKey: graphTemplate.id) == nil else { return }
+
+        graphTemplatesByID[graphTemplate.id] = graphTemplate
+        graphTemplateIDsByPath[path, default: []].insert(graphTemplate.id)
+        addFile(atPath: path)
+    }
+
+
+    /// Removes the ID from the IDs at the path, and the path once it has no IDs left.
+    private static func remove<ID: Hashable>(_ id: ID, atPath path: String, from idsByPath: inout [String : Set<ID>]) {
+        guard var ids = idsByPath[path] else { return }
+
+        ids.remove(id)
+
+        idsByPath[path] = ids.isEmpty ? nil : ids
+    }
+
+
+    private func addFile(atPath path: String) {
+        let directory = FileChangeMonitor.directory(of: path)
+
+        if let count = numberOfFilesInDirectories[directory] {
+            numberOfFilesInDirectories[directory] = count + 1
+        } else {
+            numberOfFilesInDirectories[directory] = 1
+            didChangeDirectories = true
+        }
+    }
+
+
+    private func removeFile(atPath path: String) {
+        let directory = FileChangeMonitor.directory(of: path)
+
+        guard let count = numberOfFilesInDirectories[directory] else { return }
+
+        if count > 1 {
+            numberOfFilesInDirectories[directory] = count - 1
+        } else {
+            numberOfFilesInDirectories.removeValue(forKey: directory)
+            didChangeDirectories = true
+        }
+    }
+
+
+    private static func directory(of path: String) -> String {
+        (path as NSString).deletingLastPathComponent
+    }
+
+
+
+    // MARK: - Watched Directories
+    /// Updates the watched directories on the next turn of the main actor, so that an import only restarts the stream once.
+    private func scheduleWatchUpdate() {
+        guard pendingWatchUpdate == nil else { return }
+
+        pendingWatchUpdate = Task {
+            self.pendingWatchUpdate = nil
+            self.didChangeDirectories = false
+            self.watcher.watch(FileChangeMonitor.topmostDirectories(Array(self.numberOfFilesInDirectories.keys)))
+        }
+    }
+
+
+    /// The directories that are not inside another one of the directories.
+    static func topmostDirectories(_ directories: [String]) -> [String] {
+        // With a trailing slash, everything inside a directory sorts directly after it
+        let sortedDirectories = directories.map { $0.hasSuffix("/") ? $0 : $0 + "/" }.sorted()
+
+        var output: [String] = []
+        var lastDirectory: String? = nil
+
+        for nextDirectory in sortedDirectories {
+            if let lastDirectory, nextDirectory.hasPrefix(lastDirectory) { continue }
+
+            output.append(nextDirectory)
+            lastDirectory = nextDirectory
+        }
+
+        return output.map { FileSystemWatcher.normalized($0) }
+    }
+
+
+
+    // MARK: - Receiving Changes
+    private func receive(_ changes: FileSystemWatcher.Changes) {
+        for nextPath in changes.paths {
+            addPendingChange(atPath: nextPath)
+        }
+
+        // Rare: FSEvents dropped events, so everything below the directory is treated as changed
+        for nextDirectory in changes.rescannedDirectories {
+            let prefix = nextDirectory.hasSuffix("/") ? nextDirectory : nextDirectory + "/"
+
+            for (nextPath, nextIDs) in dataItemIDsByPath where nextPath.hasPrefix(prefix) {
+                addPendingDataItems(nextIDs)
+            }
+
+            for (nextPath, nextIDs) in graphTemplateIDsByPath where nextPath.hasPrefix(prefix) {
+                addPendingGraphTemplates(nextIDs)
+            }
+        }
+
+        scheduleReport()
+    }
+
+
+    /// Finds the Data Items or Graph Templates at the path or at the closest enclosing path (e.g. the package of a Graph Template).
+    private func addPendingChange(atPath path: String) {
+        var nextPath = path
+
+        while nextPath.count > 1 {
+            if let dataItemIDs = dataItemIDsByPath[nextPath] {
+                addPendingDataItems(dataItemIDs)
+                return
+            }
+
+            if let graphTemplateIDs = graphTemplateIDsByPath[nextPath] {
+                addPendingGraphTemplates(graphTemplateIDs)
+                return
+            }
+
+            nextPath = FileChangeMonitor.directory(of: nextPath)
+        }
+    }
+
+
+    private func addPendingDataItems(_ ids: Set<DataItem.ID>) {
+        for nextID in ids {
+            pendingDataItems[nextID] = dataItemsByID[nextID]
+        }
+    }
+
+
+    private func addPendingGraphTemplates(_ ids: Set<GraphTemplate.ID>) {
+        for nextID in ids {
+            pendingGraphTemplates[nextID] = graphTemplatesByID[nextID]
+        }
+    }
+
+
+    private func scheduleReport() {
+        if pendingDataItems.isEmpty && pendingGraphTemplates.isEmpty { return }
+
+        pendingReport?.cancel()
+
+        pendingReport = Task {
+            try? await Task.sleep(for: FileChangeMonitor.coalescingDelay)
+
+            if Task.isCancelled { return }
+
+            let dataItems = Array(self.pendingDataItems.values)
+            let graphTemplates = Array(self.pendingGraphTemplates.values)
+
+            self.pendingDataItems = [:]
+            self.pendingGraphTemplates = [:]
+
+            self.delegate?.filesDidChange(dataItems: dataItems, graphTemplates: graphTemplates)
+        }
+    }
+}
@@ -0,0 +1,15 @@
+//
+//  FileChangeMonitorDelegate.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+protocol FileChangeMonitorDelegate {
+
+    /// The files of the Data Items or Graph Templates were modified, replaced or removed on disk.
+    func filesDidChange(dataItems: [DataItem], graphTemplates: [GraphTemplate])
+}
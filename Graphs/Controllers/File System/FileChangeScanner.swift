@@ -0,0 +1,65 @@
+//
+//  FileChangeScanner.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// Finds the files that changed since their signatures were recorded, e.g. on a network drive while the app was closed.
+///
+/// The files are read in chunks with at most `maximumConcurrency` chunks in flight, so a slow drive is read in parallel without starting a task per file.
+struct FileChangeScanner: Sendable {
+
+    /// A file and the signature it had when it was last parsed.
+    struct Entry: Sendable {
+        let dataItemID: DataItem.LocalID
+        let url: URL
+        let signature: FileSignature
+    }
+
+
+    var maximumConcurrency = 8
+
+    /// Number of files read by each task.
+    var chunkSize = 64
+
+
+    /// IDs of the entries whose file changed or can no longer be read.
+    func changedDataItemIDs(in entries: [Entry]) async -> Set<DataItem.LocalID> {
+        let chunks = stride(from: 0, to: entries.count, by: chunkSize).map { nextStart in
+            entries[nextStart ..< min(nextStart + chunkSize, entries.count)]
+        }
+
+        return await withTaskGroup(of: [DataItem.LocalID].self) { group in
+            var output: Set<DataItem.LocalID> = []
+            var remainingChunks = chunks.makeIterator()
+
+            // Start the first chunks, then one more as each one finishes
+            for _ in 0 ..< maximumConcurrency {
+                guard let nextChunk = remainingChunks.next() else { break }
+                group.addTask { FileChangeScanner.changedDataItemIDs(in: nextChunk) }
+            }
+
+            for await nextChangedIDs in group {
+                output.formUnion(nextChangedIDs)
+
+                if let nextChunk = remainingChunks.next() {
+                    group.addTask { FileChangeScanner.changedDataItemIDs(in: nextChunk) }
+                }
+            }
+
+            return output
+        }
+    }
+
+
+    private static func changedDataItemIDs(in chunk: ArraySlice<Entry>) -> [DataItem.LocalID] {
+        chunk.compactMap { nextEntry in
+            FileSignature(contentsOf: nextEntry.url) == nextEntry.signature ? nil : nextEntry.dataItemID
+        }
+    }
+}
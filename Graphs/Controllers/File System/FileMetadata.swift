@@ -0,0 +1,43 @@
+//
+//  FileMetadata.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// The resource values of a file shown in the Data Items table, and when they were read.
+struct FileMetadata: Sendable, Equatable {
+
+    var fileSize: Int
+
+    var contentCreationDate: Date?
+
+    var contentModificationDate: Date?
+
+    /// When the resource values were read from the file system.
+    var fetchDate: Date
+
+
+    static let resourceKeys: Set<URLResourceKey> = [.totalFileSizeKey, .creationDateKey, .contentModificationDateKey]
+
+
+    /// Reads the resource values of `url`.  A missing file results in empty metadata so that it isn't read again until it is refreshed.
+    init(contentsOf url: URL) {
+        let values = try? url.resourceValues(forKeys: FileMetadata.resourceKeys)
+
+        self.fileSize = values?.totalFileSize ?? 0
+        self.contentCreationDate = values?.creationDate
+        self.contentModificationDate = values?.contentModificationDate
+        self.fetchDate = .now
+    }
+
+
+    /// True if the values were read longer ago than `interval`.
+    func isOlder(than interval: TimeInterval) -> Bool {
+        fetchDate.timeIntervalSinceNow < -interval
+    }
+}
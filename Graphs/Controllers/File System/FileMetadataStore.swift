@@ -0,0 +1,154 @@
+//
+//  FileMetadataStore.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// Reads the size and dates of files off of the main actor and keeps them for the Data Items table.
+///
+/// Reading a missing or stale value returns what is cached (or nil) and queues the URL.  URLs queued while a table is drawn are read together in one batch: the batch is split into chunks that are read concurrently, and the results are published with a single change so that scrolling only redraws once per batch.  `.fileMetadataDidChange` is posted after each batch.
+///
+/// Values are read again when they are older than `refreshInterval` or when `refresh(_:)` is called for a changed file.
+///
+/// Example Usage
+///```swift
+/// let fileSize = FileMetadataStore.shared.metadata(for: dataItem.url)?.fileSize ?? 0
+/// ```
+@Observable
+@MainActor
+final class FileMetadataStore {
+    static let shared = FileMetadataStore()
+
+    private(set) var metadata: [URL : FileMetadata] = [:]
+
+    /// Cached values older than this are read again the next time they are used.
+    static let refreshInterval: TimeInterval = 5 * 60
+
+    /// Largest number of URLs read before the results are published.
+    static let maximumBatchSize = 512
+
+    /// Number of URLs read by each concurrent task of a batch.
+    static let chunkSize = 32
+
+    /// URLs waiting to be read, in the order they were requested.
+    @ObservationIgnored
+    private var pendingURLs: [URL] = []
+
+    /// URLs that are pending or being read.
+    @ObservationIgnored
+    private var requestedURLs: Set<URL> = []
+
+    @ObservationIgnored
+    private var loadingTask: Task<Void, Never>?
+
+
+    private init() { }
+
+
+
+    // MARK: - Accessing Metadata
+    /// The cached metadata of `url`.  Missing or stale metadata is queued to be read.
+    func metadata(for url: URL) -> FileMetadata? {
+        let cached = metadata[url]
+
+        if cached?.isOlder(than: FileMetadataStore.refreshInterval) ?? true {
+            request([url])
+        }
+
+        return cached
+    }
+
+
+    /// Queues the URLs that have no cached metadata or stale metadata, such as the rows next to the visible rows of a table.
+    func prefetch(_ urls: some Sequence<URL>) {
+        request(urls.filter { metadata[$0]?.isOlder(than: FileMetadataStore.refreshInterval) ?? true })
+    }
+
+
+    /// Reads the cached metadata of `urls` again, e.g. after the files changed on disk.  The old values are kept until the new ones arrive.
+    func refresh(_ urls: some Sequence<URL>) {
+        request(urls.filter { metadata[$0] != nil })
+    }
+
+
+    func refreshAll() {
+        request(metadata.keys)
+    }
+
+
+    func remove(_ urls: some Sequence<URL>) {
+        var localMetadata = metadata
+
+        for nextURL in urls {
+            localMetadata.removeValue(forKey: nextURL)
+        }
+
+        if localMetadata.count != metadata.count {
+            metadata = localMetadata
+        }
+    }
+
+
+
+    // MARK: - Reading
+    private func request(_ urls: some Sequence<URL>) {
+        for nextURL in urls where requestedURLs.insert(nextURL).inserted {
+            pendingURLs.append(nextURL)
+        }
+
+        guard loadingTask == nil, !pendingURLs.isEmpty else { return }
+
+        // Starting on the next turn of the main actor collects every URL requested while the table is drawn
+        loadingTask = Task {
+            await loadPendingURLs()
+            loadingTask = nil
+        }
+    }
+
+
+    private func loadPendingURLs() async {
+        while !pendingURLs.isEmpty {
+            let batch = Array(pendingURLs.prefix(FileMetadataStore.maximumBatchSize))
+            pendingURLs.removeFirst(batch.count)
+
+            let loadedMetadata = await FileMetadataStore.read(batch)
+
+            metadata.merge(loadedMetadata) { _, new in new }
+            requestedURLs.subtract(batch)
+
+            NotificationCenter.default.post(name: .fileMetadataDidChange,
+                                            object: nil,
+                                            userInfo: [Notification.UserInfoKey.urls : batch])
+        }
+    }
+
+
+    /// Reads the metadata of `urls` in concurrent chunks.
+    nonisolated private static func read(_ urls: [URL]) async -> [URL : FileMetadata] {
+        await withTaskGroup(of: [(URL, FileMetadata)].self) { group in
+            for nextStart in stride(from: 0, to: urls.count, by: chunkSize) {
+                let chunk = urls[nextStart ..< min(nextStart + chunkSize, urls.count)]
+
+                group.addTask {
+                    chunk.map { ($0, FileMetadata(contentsOf: $0)) }
+                }
+            }
+
+            var output: [URL : FileMetadata] = [:]
+            output.reserveCapacity(urls.count)
+
+            for await nextChunk in group {
+                for (nextURL, nextMetadata) in nextChunk {
+                    output[nextURL] = nextMetadata
+                }
+            }
+
+            return output
+        }
+    }
+}
@@ -0,0 +1,35 @@
+//
+//  FileSignature.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// The size, modification time and inode of a file, read with a single `stat`.
+///
+/// Two signatures of the same path differ if the file was written (size or time) or replaced by another file (inode), e.g. by an editor that saves to a temporary file and renames it.
+struct FileSignature: Codable, Sendable, Equatable {
+
+    var size: Int64
+
+    /// Seconds since 1970, including nanoseconds.
+    var modificationTime: Double
+
+    var inode: UInt64
+
+
+    /// Nil if the file can't be read (e.g. it was removed).
+    init?(contentsOf url: URL) {
+        var fileStatus = stat()
+
+        guard stat(url.path(percentEncoded: false), &fileStatus) == 0 else { return nil }
+
+        self.size = Int64(fileStatus.st_size)
+        self.modificationTime = Double(fileStatus.st_mtimespec.tv_sec) + Double(fileStatus.st_mtimespec.tv_nsec) / 1_000_000_000
+        self.inode = UInt64(fileStatus.st_ino)
+    }
+}
@@ -0,0 +1,153 @@
+//
+//  FileSystemWatcher.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+import CoreServices
+import OSLog
+
+
+/// Reports the files that change below a set of directories, using an FSEvents stream.
+///
+/// FSEvents coalesces the events of each `latency` interval, and the paths of an interval are reported together.  The stream is scheduled on the main queue, so the handler is called on the main actor.
+@MainActor
+final class FileSystemWatcher {
+
+    /// Paths reported by one callback of the stream.
+    struct Changes {
+        /// Files or packages that were created, removed, renamed or modified.
+        var paths: Set<String> = []
+
+        /// Directories whose events were dropped by FSEvents.  Anything below them may have changed.
+        var rescannedDirectories: Set<String> = []
+
+        var isEmpty: Bool {
+            paths.isEmpty && rescannedDirectories.isEmpty
+        }
+    }
+
+
+    /// Seconds that FSEvents waits to coalesce events before calling the handler.
+    let latency: TimeInterval
+
+    private let handler: @MainActor (Changes) -> Void
+
+    private var stream: FSEventStreamRef?
+
+    /// The watched directories.
+    private(set) var directories: [String] = []
+
+    /// Events that change the content of a file.  Metadata only events (e.g. extended attributes written by the Finder) are ignored.
+    private static let contentChangeFlags = kFSEventStreamEventFlagItemCreated | kFSEventStreamEventFlagItemRemoved | kFSEventStreamEventFlagItemRenamed | kFSEventStreamEventFlagItemModified
+
+    private static let rescanFlags = kFSEventStreamEventFlagMustScanSubDirs | kFSEventStreamEventFlagRootChanged
+
+
+    init(latency: TimeInterval = 1, handler: @escaping @MainActor (Changes) -> Void) {
+        self.latency = latency
+        self.handler = handler
+    }
+
+
+
+    // MARK: - Watching
+    /// Replaces the watched directories.  The stream is only restarted if the directories changed.
+    func watch(_ directories: [String]) {
+        if directories == self.directories { return }
+
+        stop()
+
+        self.directories = directories
+
+        guard !directories.isEmpty else { return }
+
+        var context = FSEventStreamContext(version: 0,
+                                           info: Unmanaged.passUnretained(self).toOpaque(),
+                                           retain: nil,
+                                           release: nil,
+                                           copyDescription: nil)
+
+        let flags = FSEventStreamCreateFlags(kFSEventStreamCreateFlagFileEvents | kFSEventStreamCreateFlagUseCFTypes | kFSEventStreamCreateFlagWatchRoot)
+
+        guard let newStream = FSEventStreamCreate(kCFAllocatorDefault,
+                                                  FileSystemWatcher.callback,
+                                                  &context,
+                                                  directories as CFArray,
+                                                  FSEventStreamEventId(kFSEventStreamEventIdSinceNow),
+                                                  latency,
+                                                  flags) else {
+            Logger.fileSystem.error("FileSystemWatcher: Could not create an event stream for \(directories.count) directories")
+            return
+        }
+
+        FSEventStreamSetDispatchQueue(newStream, DispatchQueue.main)
+
+        if FSEventStreamStart(newStream) {
+            stream = newStream
+        } else {
+            Logger.fileSystem.error("FileSystemWatcher: Could not start the event stream")
+            FSEventStreamInvalidate(newStream)
+            FSEventStreamRelease(newStream)
+        }
+    }
+
+
+    /// Stops reporting changes.  Must be called before the watcher is released.
+    func stop() {
+        directories = []
+
+        guard let stream else { return }
+
+        FSEventStreamStop(stream)
+        FSEventStreamInvalidate(stream)
+        FSEventStreamRelease(stream)
+
+        self.stream = nil
+    }
+
+
+
+    // MARK: - Events
+    private static let callback: FSEventStreamCallback = { _, info, numberOfEvents, eventPaths, eventFlags, _ in
+        guard let info else { return }
+
+        let watcher = Unmanaged<FileSystemWatcher>.fromOpaque(info).takeUnretainedValue()
+
+        // kFSEventStreamCreateFlagUseCFTypes reports the paths as a CFArray of CFStrings
+        guard let paths = Unmanaged<CFArray>.fromOpaque(eventPaths).takeUnretainedValue() as? [String] else { return }
+
+        var changes = Changes()
+
+        for index in 0 ..< min(numberOfEvents, paths.count) {
+            let flags = Int(eventFlags[index])
+            let path = FileSystemWatcher.normalized(paths[index])
+
+            if flags & rescanFlags != 0 {
+                changes.rescannedDirectories.insert(path)
+            } else if flags & contentChangeFlags != 0 {
+                changes.paths.insert(path)
+            }
+        }
+
+        if changes.isEmpty { return }
+
+        // The stream is scheduled on the main queue
+        MainActor.assumeIsolated {
+            watcher.handler(changes)
+        }
+    }
+
+
+    /// The path without a trailing slash, matching `URL.watchedPath`.
+    nonisolated static func normalized(_ path: String) -> String {
+        if path.count > 1 && path.hasSuffix("/") {
+            return String(path.dropLast())
+        }
+
+        return path
+    }
+}
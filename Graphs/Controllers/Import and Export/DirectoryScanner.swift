@@ -0,0 +1,120 @@
+//
+//  DirectoryScanner.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+import OSLog
+
+
+/// Walks directory trees off of the main actor and collects everything that can be imported.
+///
+/// Subdirectories are scanned concurrently.  Resource values are fetched together with the directory contents so that no file is visited twice, and files are filtered against a precomputed set of lowercased File Extensions.
+struct DirectoryScanner: Sendable {
+
+    /// Lowercased extensions of the files that are imported as Data Items.
+    let allowedExtensions: Set<String>
+
+    static let resourceKeys: [URLResourceKey] = [.isDirectoryKey, .isPackageKey, .isRegularFileKey, .totalFileSizeKey, .contentModificationDateKey]
+
+
+    /// A scanned directory and everything below it.
+    struct Directory: Sendable {
+        let url: URL
+        var dataFiles: [File] = []
+        var graphTemplateURLs: [URL] = []
+        var parserSettingsURLs: [URL] = []
+        var subdirectories: [Directory] = []
+
+        /// Number of directories and Data Items in the tree, including this directory.
+        var numberOfItems: Int {
+            subdirectories.reduce(1 + dataFiles.count) { $0 + $1.numberOfItems }
+        }
+    }
+
+
+    struct File: Sendable {
+        let url: URL
+        let fileSize: Int
+        let contentModificationDate: Date?
+
+        /// Security scoped bookmark created during the scan so that it isn't created on the main actor.
+        let bookmarkData: Data?
+    }
+
+
+    init(allowedExtensions: some Sequence<String>) {
+        self.allowedExtensions = Set(allowedExtensions.map { $0.lowercased() })
+    }
+
+
+    /// Scans `url` and all of its subdirectories.
+    ///
+    /// - Parameter didScanDirectory: Called after each directory with the number of Data Items found in it.
+    func scan(_ url: URL, didScanDirectory: @escaping @Sendable (Int) async -> Void) async throws -> Directory {
+        try Task.checkCancellation()
+
+        var directory = Directory(url: url)
+        var subdirectoryURLs: [URL] = []
+
+        let contentURLs = try FileManager.default.contentsOfDirectory(at: url,
+                                                                      includingPropertiesForKeys: DirectoryScanner.resourceKeys,
+                                                                      options: [.skipsHiddenFiles, .skipsPackageDescendants])
+
+        for nextURL in contentURLs {
+            let values = try? nextURL.resourceValues(forKeys: Set(DirectoryScanner.resourceKeys))
+
+            // Graph Templates are packages, so check the extensions before checking for directories
+            if nextURL.pathExtension == URL.dataGraphFileExtension {
+                directory.graphTemplateURLs.append(nextURL)
+                continue
+            } else if nextURL.pathExtension == URL.parserSettingsFileExtension {
+                directory.parserSettingsURLs.append(nextURL)
+                continue
+            }
+
+            if values?.isDirectory == true && values?.isPackage != true {
+                subdirectoryURLs.append(nextURL)
+            } else if values?.isRegularFile == true && allowedExtensions.contains(nextURL.pathExtension.lowercased()) {
+                let bookmarkData = try? nextURL.bookmarkData(options: .withSecurityScope)
+
+                directory.dataFiles.append(File(url: nextURL,
+                                                fileSize: values?.totalFileSize ?? 0,
+                                                contentModificationDate: values?.contentModificationDate,
+                                                bookmarkData: bookmarkData))
+            }
+        }
+
+        await didScanDirectory(directory.dataFiles.count)
+
+        directory.subdirectories = try await withThrowingTaskGroup(of: Directory?.self) { group in
+            for nextURL in subdirectoryURLs {
+                group.addTask {
+                    do {
+                        return try await scan(nextURL, didScanDirectory: didScanDirectory)
+                    } catch is CancellationError {
+                        throw CancellationError()
+                    } catch {
+                        // An unreadable subdirectory should not stop the rest of the import
+                        Logger.dataController.info("DirectoryScanner: Could not read \(nextURL.path(percentEncoded: false)): \(error)")
+                        return nil
+                    }
+                }
+            }
+
+            var output: [Directory] = []
+
+            for try await nextDirectory in group {
+                if let nextDirectory { output.append(nextDirectory) }
+            }
+
+            // Keep the import order independent of which scan finished first
+            return output.sorted { $0.url.lastPathComponent < $1.url.lastPathComponent }
+        }
+
+        return directory
+    }
+}
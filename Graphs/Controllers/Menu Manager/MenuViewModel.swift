@@ -8,6 +8,7 @@
 
 import Foundation
 import AppKit
+import OSLog
 
 @Observable
 @MainActor
@@ -243,6 +244,28 @@ class MenuViewModel {
         selectionManager.deselectAll()
     }
     
+    
+    // MARK: - Processing Statistics
+    /// Copies the p50/p95/p99 time of each pipeline stage for the current session as tab separated text.
+    func copyProcessingStatistics() {
+        let report = PipelineStatistics.shared.report()
+        
+        Logger.processingData.info("Processing statistics:\n\(report)")
+        
+        let pb = NSPasteboard.general
+        pb.clearContents()
+        pb.setString(report, forType: .string)
+    }
+    
+    var toolTip_copyProcessingStatistics: String {
+        "Copies how long each processing stage (reading, parsing, graphing and caching) has taken during this session"
+    }
+    
+    
+    func resetProcessingStatistics() {
+        PipelineStatistics.shared.reset()
+    }
+    
 }
 
 // MARK: - Button State
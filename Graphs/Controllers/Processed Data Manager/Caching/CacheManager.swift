@@ -19,49 +19,53 @@ class CacheManager {
 // MARK: - Data Caching
 extension CacheManager {
     
-    
+    /// State of the cached ParsedFile, answered from the CacheManifest.
+    @MainActor
     func parsedFileCacheState(for dataItem: DataItem) -> CachedState {
-        guard let dateCacheLastModified = self.cachedDataURL(for: dataItem)?.dateLastModified else {
-            return .noCache
-        }
-        
-        guard let dateParserSettingsLastModified = dataItem.getAssociatedParserSettings()?.lastModified else {
-            return .cacheShouldBeRemoved
-        }
-        
-        if dateParserSettingsLastModified > dateCacheLastModified {
-            return .cacheNeedsUpdate
-        } else {
-            return .cachedStorageUpToDate
-        }
+        let parserSettingsVersion = EffectiveSettingsResolver.shared.parserSettings(for: dataItem)?.lastModified
         
+        return CacheManifest.shared.parsedFileState(of: dataItem.localID, parserSettingsVersion: parserSettingsVersion)
     }
     
     
-    private func cacheDataFileName(for dataItem: DataItem) -> String {
-        let fileName = dataItem.name + "-cachedData-" + dataItem.localID.uuidString
+    private func cachedDataURL(for contentKey: ContentKey) -> URL {
+        let fileName = "parsedData-" + contentKey.fileName
         
-        return fileName
+        return URL.cachedProcessedDataDirectory.appending(path: fileName)
     }
     
     
-    private func cachedDataURL(for dataItem: DataItem) -> URL? {
-        let fileName = cacheDataFileName(for: dataItem)
-         
-        let startingURL = URL.cachedProcessedDataDirectory
+    /// Writes the ParsedFile to the cache under the ContentKey of the data file and records it in the CacheManifest.
+    ///
+    /// If another Data Item already cached the same content with equal Parser Settings, the Data Item refers to that file instead of writing a copy.
+    ///
+    /// - Parameters:
+    ///   - sourceURL: The data file that was parsed.
+    ///   - parserSettings: The Parser Settings the file was parsed with, read before parsing.
+    func cacheData(parsedFile: ParsedFile, for dataItemID: DataItem.LocalID, sourceURL: URL, parserSettings: ParserSettingsStatic) async {
+        let manifest = CacheManifest.shared
+        let signature = FileSignature(contentsOf: sourceURL)
+        
+        // A lookup that missed may already have hashed the file
+        var lookedUpContentKey: ContentKey? = nil
+        
+        if let signature {
+            lookedUpContentKey = await manifest.takeContentKey(of: dataItemID, signature: signature)?.parsed(with: parserSettings)
+        }
         
-    
-        let cacheDataURL = startingURL.appending(path: fileName)
+        guard let contentKey = lookedUpContentKey ?? ContentKey(fileAt: sourceURL, parserSettings: parserSettings) else { return }
         
-        return cacheDataURL
-    }
-    
-    
-    func cacheData(parsedFile: ParsedFile, for dataItem: DataItem) {
-        guard let targetURL = cachedDataURL(for: dataItem) else {
+        // The file changed since it was parsed, so the key doesn't describe the ParsedFile
+        guard await manifest.fileSignature(for: dataItemID) == signature else { return }
+        
+        if await manifest.adoptParsedFile(contentKey, for: dataItemID, parserSettingsVersion: parserSettings.lastModified) {
+            await self.removeReleasedFiles()
+            await CacheManager.cacheColumnStatistics(of: parsedFile, for: contentKey)
             return
         }
         
+        let targetURL = cachedDataURL(for: contentKey)
+        
         // Create the Cache Processed Data Directory if necessary
         let cacheDirectoryURL = URL.cachedProcessedDataDirectory
         
@@ -84,88 +88,133 @@ extension CacheManager {
         }
         
         
-        // Get the Parsed File to cache
-        let cachedParsedFile = parsedFile
+        let numberOfRows = parsedFile.data.first?.data.count ?? 0
+        
+        let encodeInterval = PipelineTrace.begin(.cacheEncode, dataItemID: dataItemID)
         
-        let encoder = JSONEncoder()
-        guard let data = try? encoder.encode(cachedParsedFile) else {
+        guard let data = try? ParsedFileArchive.encode(parsedFile) else {
             let logger = Logger(subsystem: "edu.HRG.Graphs", category: "Caching")
             logger.error("Could not encode cached Parsed File")
             return
         }
         
+        encodeInterval.end(bytes: data.count, rows: numberOfRows)
+        
         
         // Try to save the data
         do {
-            try data.write(to: targetURL)
+            try PipelineTrace.measure(.cacheWrite, dataItemID: dataItemID, bytes: data.count) {
+                try data.write(to: targetURL, options: .atomic)
+            }
         } catch  {
             let logger = Logger(subsystem: "edu.HRG.Graphs", category: "Caching")
             logger.error("Could not write cached parsed file to: \(targetURL.path())")
             logger.error("\(error.localizedDescription)")
+            return
         }
+        
+        await manifest.recordParsedFile(contentKey, of: dataItemID, byteSize: data.count, parserSettingsVersion: parserSettings.lastModified)
+        await self.removeReleasedFiles()
+        await self.enforceBudget()
+        
+        await CacheManager.cacheColumnStatistics(of: parsedFile, for: contentKey)
     }
     
     
-    func loadCachedParsedData(for dataItem: DataItem) -> ParsedFile? {
+    /// The cached ParsedFile if the CacheManifest lists it as up to date, or if the same content was cached for another Data Item with equal Parser Settings.
+    ///
+    /// - Parameter parserSettings: The Parser Settings the Data Item uses now.
+    func loadCachedParsedData(for dataItem: DataItem, parserSettings: ParserSettingsStatic) async -> ParsedFile? {
+        let manifest = CacheManifest.shared
+        let dataItemID = dataItem.localID
         
-        switch self.parsedFileCacheState(for: dataItem) {
-        case .noCache: return nil
-        case .cacheNeedsUpdate: return nil
-        case .cachedStorageUpToDate: break
-        case .cacheShouldBeRemoved: return nil
-        }
+        var contentKey: ContentKey? = nil
         
+        if await self.parsedFileCacheState(for: dataItem) == .cachedStorageUpToDate {
+            contentKey = await manifest.cachedFile(.parsedFile, of: dataItemID)?.contentKey
+        }
         
-        guard let cacheURL = try? self.cacheGraphURL(for: dataItem) else {
-            let logger = Logger(subsystem: "edu.HRG.Graphs", category: "Caching")
-            logger.error("Could not create get cached parsed data url for: \(dataItem.name)")
-            return nil
+        // Look the content up, e.g. for a file that was imported again
+        if contentKey == nil {
+            let dataItemURL = dataItem.url
+            
+            // The file is only hashed if a stored parsed file was made from a file of the same size
+            guard let signature = FileSignature(contentsOf: dataItemURL),
+                  await manifest.hasStoredParsedFile(ofByteCount: signature.size) else { return nil }
+            
+            guard let fileContentKey = ContentKey(fileAt: dataItemURL, parserSettings: parserSettings) else { return nil }
+            
+            guard await manifest.isStored(fileContentKey) else {
+                await manifest.rememberContentKey(fileContentKey, of: dataItemID, signature: signature)
+                return nil
+            }
+            
+            await manifest.recordParse(of: dataItemID, signature: signature)
+            
+            guard await manifest.adoptParsedFile(fileContentKey, for: dataItemID, parserSettingsVersion: parserSettings.lastModified) else { return nil }
+            
+            await self.removeReleasedFiles()
+            
+            contentKey = fileContentKey
         }
         
-        let fm = FileManager.default
+        guard let contentKey else { return nil }
         
-        if !fm.fileExists(atPath: cacheURL.path()) {
-            return nil
-        }
+        let cacheURL = self.cachedDataURL(for: contentKey)
         
-        guard let data = try? Data(contentsOf: cacheURL) else {
+        let readInterval = PipelineTrace.begin(.cacheRead, dataItemID: dataItemID)
+        
+        // A listed file that is missing is forgotten with its statistics, so the next parse caches it again
+        guard let data = try? Data(contentsOf: cacheURL, options: .alwaysMapped) else {
             let logger = Logger(subsystem: "edu.HRG.Graphs", category: "Caching")
             logger.error("Could not get cached parsed data from: \(cacheURL)")
+            
+            await self.removeUnreadableParsedFile(contentKey)
             return nil
         }
         
-        let decoder = JSONDecoder()
+        readInterval.end(bytes: data.count)
         
-        var cachedParsedFile: ParsedFile? = nil
+        var cachedParsedFile: ParsedFile
         
         do {
-            cachedParsedFile = try decoder.decode(ParsedFile.self, from: data)
+            let decodeInterval = PipelineTrace.begin(.cacheDecode, dataItemID: dataItemID)
+            cachedParsedFile = try ParsedFileArchive(data: data).parsedFile()
+            decodeInterval.end(bytes: data.count, rows: cachedParsedFile.data.first?.data.count ?? 0)
         } catch  {
             let logger = Logger(subsystem: "edu.HRG.Graphs", category: "Caching")
             logger.error("Could not created cached parsed data from: \(cacheURL)")
             
-            return cachedParsedFile
+            await self.removeUnreadableParsedFile(contentKey)
+            return nil
         }
         
         
+        // The file may have been written for another Data Item with the same content
+        cachedParsedFile.dataItemID = dataItemID
         
-        if cachedParsedFile?.dataItemID != dataItem.localID {
-            let logger = Logger(subsystem: "edu.HRG.Graphs", category: "Caching")
-            logger.error("Current DataItem ID does not Match Cached DataItem ID")
-            
-            return nil
+        await CacheManifest.shared.recordAccess(.parsedFile, of: dataItemID)
+        
+        // Files cached before statistics were kept get them on their first read, without delaying it
+        let parsedFileToSummarize = cachedParsedFile
+        
+        Task.detached(priority: .utility) {
+            await CacheManager.cacheColumnStatistics(of: parsedFileToSummarize, for: contentKey)
         }
         
         return cachedParsedFile
         
     }
     
-    private func cacheGraphOutOfDate(for dataItem: DataItem) {
+    
+    /// Forgets a listed parsed file that can't be read and removes it and its statistics.
+    @MainActor
+    private func removeUnreadableParsedFile(_ contentKey: ContentKey) {
+        CacheManifest.shared.removeParsedFile(contentKey)
         
+        self.removeReleasedFiles()
     }
     
-    // TODO: Implement cache removal when out of date
-    
 }
 
 
@@ -173,47 +222,27 @@ extension CacheManager {
 // MARK: - Graph Caching
 extension CacheManager {
     
+    /// State of the cached graph, answered from the CacheManifest.
+    @MainActor
     func graphCacheState(for dataItem: DataItem) -> CachedState {
-        guard let dateCacheLastModified = try? self.cacheGraphURL(for: dataItem).dateLastModified else {
-            return .noCache
-        }
-        
-        guard let dateGraphTemplateLastModified = dataItem.getAssociatedGraphTemplate()?.contentModificationDate else {
-            return .cacheShouldBeRemoved
-        }
+        let graphTemplate = EffectiveSettingsResolver.shared.graphTemplate(for: dataItem)
+        let parserSettingsVersion = EffectiveSettingsResolver.shared.parserSettings(for: dataItem)?.lastModified
         
-        if dateGraphTemplateLastModified > dateCacheLastModified {
-            return .cacheNeedsUpdate
-        } else {
-            return .cachedStorageUpToDate
-        }
+        return CacheManifest.shared.graphState(of: dataItem.localID, graphTemplate: graphTemplate, parserSettingsVersion: parserSettingsVersion)
     }
     
     
-    private func cacheDataGraphFileName(for dataItem: DataItem) throws -> String {
-        
-        // guard let dataItem else { throw ProcessedDataError.noDataItemToCache }
+    private func cacheGraphURL(for dataItemID: DataItem.LocalID) -> URL {
+        let fileName = "cachedGraph-" + dataItemID.uuidString
         
-        let fileName = dataItem.name + "-cachedGraph-" + dataItem.localID.uuidString
-        
-        return fileName
+        return URL.cachedGraphedDataDirectory.appending(path: fileName)
     }
     
     
-    private func cacheGraphURL(for dataItem: DataItem) throws -> URL {
-        let fileName = try cacheDataGraphFileName(for: dataItem)
-        
-        let startingURL = URL.cachedGraphedDataDirectory
-        
-        let cacheGraphURL = startingURL.appending(path: fileName)
-        
-        return cacheGraphURL
-    }
-    
     @MainActor
     func cacheGraphController(graphController: GraphController, for dataItem: DataItem) {
         
-        guard let targetURL = try? cacheGraphURL(for: dataItem) else { return }
+        let targetURL = cacheGraphURL(for: dataItem.localID)
         
         guard let dgController = graphController.dgController else { return }
         
@@ -235,16 +264,26 @@ extension CacheManager {
         
         // Write Data Graph file
         do {
-            try dgController.write(to: targetURL)
+            try PipelineTrace.measure(.cacheWrite, dataItemID: dataItem.localID) {
+                try dgController.write(to: targetURL)
+            }
         } catch {
             let logger = Logger(subsystem: "edu.HRG.Graphs", category: "Caching")
             logger.error("Could not write cached parsed file to: \(targetURL.path())")
             logger.error("\(error.localizedDescription)")
             return
         }
+        
+        let byteSize = FileSignature(contentsOf: targetURL).map { Int($0.size) } ?? 0
+        let graphTemplate = EffectiveSettingsResolver.shared.graphTemplate(for: dataItem)
+        let parserSettingsVersion = EffectiveSettingsResolver.shared.parserSettings(for: dataItem)?.lastModified
+        
+        CacheManifest.shared.recordGraph(of: dataItem.localID, byteSize: byteSize, graphTemplate: graphTemplate, parserSettingsVersion: parserSettingsVersion)
+        self.enforceBudget()
     }
     
     
+    @MainActor
     func loadGraphController(for dataItem: DataItem) -> DGController? {
         let cacheState = self.graphCacheState(for: dataItem)
         
@@ -252,15 +291,15 @@ extension CacheManager {
             return nil
         }
         
-        guard let cacheURL = try? cacheGraphURL(for: dataItem) else { return nil }
+        let cacheURL = cacheGraphURL(for: dataItem.localID)
         
-        let fm = FileManager.default
-        
-        if !fm.fileExists(atPath: cacheURL.path()) {
-            return nil
+        let controller = PipelineTrace.measure(.cacheRead, dataItemID: dataItem.localID) {
+            DGController(contentsOfFile: cacheURL.path(percentEncoded: false))
         }
         
-        let controller = DGController(contentsOfFile: cacheURL.path(percentEncoded: false))
+        if controller != nil {
+            CacheManifest.shared.recordAccess(.graph, of: dataItem.localID)
+        }
         
         return controller
         
@@ -272,52 +311,60 @@ extension CacheManager {
 // MARK: - Deleting Cache
 extension CacheManager {
     
+    /// Deletes the cached files that the CacheManifest lists for the Data Items.  Parsed files that other Data Items share are kept.
+    ///
+    /// A file that can't be deleted is logged and the remaining files are still deleted.
+    @MainActor
     func clearCache(for dataItems: [DataItem]) {
-        self.deleteProcessedDataCache(for: dataItems)
-        self.deleteGraphCache(for: dataItems)
-    }
-    
-    func emptyEntireCache() {
-        let url = URL.cacheStorageDirectory
+        let releasedFiles = CacheManifest.shared.removeCachedFiles(of: dataItems.map { $0.localID })
         
-        do {
-            let fm = FileManager.default
-            try fm.removeItem(at: url)
-        } catch  {
-            let logger = Logger(subsystem: "edu.HRG.Graphs", category: "Caching")
-            logger.error("Cannot remove entire Cache direcotry at: \(url)")
-        }
+        ColumnStatisticsStore.shared.removeStatistics(of: releasedFiles)
         
-    }
-    
-    
-    private func deleteProcessedDataCache(for dataItems: [DataItem]) {
-        for nextDataItem in dataItems {
-            guard let url = self.cachedDataURL(for: nextDataItem) else { return }
-            
-            let fm = FileManager.default
+        let fm = FileManager.default
+        
+        for nextStoredFile in releasedFiles {
+            let url = cacheURL(of: nextStoredFile)
             
             do {
                 try fm.removeItem(at: url)
+            } catch CocoaError.fileNoSuchFile {
+                continue
             } catch {
-                return
+                let logger = Logger(subsystem: "edu.HRG.Graphs", category: "Caching")
+                logger.error("Could not remove cached file at: \(url.path())")
+                logger.error("\(error.localizedDescription)")
             }
         }
     }
     
     
-    private func deleteGraphCache(for dataItems: [DataItem]) {
-        for nextDataItem in dataItems {
-            guard let url = try? self.cacheGraphURL(for: nextDataItem) else { return }
-            
-            let fm = FileManager.default
+    /// Removes the cached data and graphs, including files that the CacheManifest doesn't list.
+    @MainActor
+    func emptyEntireCache() {
+        CacheManifest.shared.removeAllCachedFiles()
+        ColumnStatisticsStore.shared.removeAllStatistics()
+        
+        let fm = FileManager.default
+        
+        for nextURL in [URL.cachedProcessedDataDirectory, URL.cachedGraphedDataDirectory] {
+            guard fm.fileExists(atPath: nextURL.path(percentEncoded: false)) else { continue }
             
             do {
-                try fm.removeItem(at: url)
-            } catch {
-                return
+                try fm.removeItem(at: nextURL)
+            } catch  {
+                let logger = Logger(subsystem: "edu.HRG.Graphs", category: "Caching")
+                logger.error("Cannot remove cache directory at: \(nextURL)")
+                logger.error("\(error.localizedDescription)")
             }
         }
     }
     
+    
+    func cacheURL(of storedFile: CacheManifest.StoredFile) -> URL {
+        switch storedFile {
+        case .parsedFile(let contentKey): return cachedDataURL(for: contentKey)
+        case .graph(let dataItemID): return cacheGraphURL(for: dataItemID)
+        }
+    }
+    
 }
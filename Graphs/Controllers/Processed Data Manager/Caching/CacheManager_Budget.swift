@@ -0,0 +1,130 @@
+//
+//  CacheManager_Budget.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+import OSLog
+
+
+// MARK: - Cache Budget
+extension CacheManager {
+    
+    /// Once the cache is over budget, the least recently used files are evicted until it is this fraction of the budget, so that eviction doesn't run after every write.
+    static let evictionTarget = 0.9
+    
+    /// Cache files modified within this interval are never removed as unlisted, because their CacheManifest record may not be written yet.
+    static let unlistedFileGracePeriod: TimeInterval = 600
+    
+    
+    /// Largest size of the cache in bytes, set in Preferences.  Zero for no limit.
+    static var budget: Int {
+        UserDefaults.standard.object(forKey: UserDefaults.cacheBudget) as? Int ?? UserDefaults.defaultCacheBudget
+    }
+    
+    
+    /// Evicts the least recently used cached files if the cache is larger than the budget.
+    ///
+    /// The files are chosen from the CacheManifest and deleted in the background.
+    @MainActor
+    func enforceBudget() {
+        let budget = CacheManager.budget
+        let manifest = CacheManifest.shared
+        
+        guard budget > 0, manifest.totalByteSize > budget else { return }
+        
+        let targetByteSize = Int(Double(budget) * CacheManager.evictionTarget)
+        let evictedFiles = manifest.removeLeastRecentlyUsedFiles(freeing: manifest.totalByteSize - targetByteSize)
+        
+        Logger.processingData.info("Evicting \(evictedFiles.count) cached files to stay within the cache budget")
+        
+        removeFilesInBackground(evictedFiles)
+    }
+    
+    
+    /// Removes the cached files of Data Items that no longer exist and the files the CacheManifest doesn't list (e.g. written by an older version), then enforces the budget.
+    @MainActor
+    func compact(existingDataItemIDs: Set<DataItem.LocalID>) {
+        let manifest = CacheManifest.shared
+        
+        let orphanFiles = manifest.removeOrphans(keeping: existingDataItemIDs)
+        
+        removeFilesInBackground(orphanFiles)
+        
+        enforceBudget()
+        
+        let storedFiles = manifest.allStoredFiles
+        let listedFileNames = Set(storedFiles.map { cacheURL(of: $0).lastPathComponent })
+        
+        ColumnStatisticsStore.shared.removeStatistics(keeping: storedFiles)
+        
+        Task.detached(priority: .background) {
+            CacheManager.removeUnlistedFiles(keeping: listedFileNames)
+        }
+    }
+    
+    
+    
+    // MARK: - Removing Files
+    /// Deletes the files that no Data Item refers to any more, e.g. the previous parsed file of a Data Item that was parsed again.
+    @MainActor
+    func removeReleasedFiles() {
+        removeFilesInBackground(CacheManifest.shared.takeReleasedFiles())
+    }
+    
+    
+    /// Deletes the files in the background and removes the statistics of the parsed files right away.
+    @MainActor
+    private func removeFilesInBackground(_ storedFiles: [CacheManifest.StoredFile]) {
+        if storedFiles.isEmpty { return }
+        
+        ColumnStatisticsStore.shared.removeStatistics(of: storedFiles)
+        
+        let urls = storedFiles.map { cacheURL(of: $0) }
+        
+        Task.detached(priority: .background) {
+            for nextURL in urls {
+                CacheManager.removeCachedFile(at: nextURL)
+            }
+        }
+    }
+    
+    
+    private static func removeUnlistedFiles(keeping listedFileNames: Set<String>) {
+        let fm = FileManager.default
+        let oldestProtectedDate = Date.now.addingTimeInterval(-unlistedFileGracePeriod)
+        
+        var numberOfRemovedFiles = 0
+        
+        for nextDirectory in [URL.cachedProcessedDataDirectory, URL.cachedGraphedDataDirectory] {
+            guard let contents = try? fm.contentsOfDirectory(at: nextDirectory, includingPropertiesForKeys: [.contentModificationDateKey], options: .skipsHiddenFiles) else { continue }
+            
+            for nextURL in contents where !listedFileNames.contains(nextURL.lastPathComponent) {
+                guard let dateLastModified = nextURL.dateLastModified, dateLastModified < oldestProtectedDate else { continue }
+                
+                removeCachedFile(at: nextURL)
+                numberOfRemovedFiles += 1
+            }
+        }
+        
+        if numberOfRemovedFiles > 0 {
+            Logger.processingData.info("Removed \(numberOfRemovedFiles) cached files that the cache manifest doesn't list")
+        }
+    }
+    
+    
+    private static func removeCachedFile(at url: URL) {
+        do {
+            try FileManager.default.removeItem(at: url)
+        } catch CocoaError.fileNoSuchFile {
+            return
+        } catch {
+            let logger = Logger(subsystem: "edu.HRG.Graphs", category: "Caching")
+            logger.error("Could not remove cached file at: \(url.path())")
+            logger.error("\(error.localizedDescription)")
+        }
+    }
+}
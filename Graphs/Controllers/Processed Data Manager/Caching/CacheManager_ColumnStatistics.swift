@@ -0,0 +1,29 @@
+//
+//  CacheManager_ColumnStatistics.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+// MARK: - Column Statistics
+/// ColumnStatistics are computed once per cached ParsedFile, when it is written or first read, and are removed with the file.
+extension CacheManager {
+    
+    /// Computes and stores the statistics of the ParsedFile cached under the ContentKey, unless they are stored already.
+    static func cacheColumnStatistics(of parsedFile: ParsedFile, for contentKey: ContentKey) async {
+        let store = ColumnStatisticsStore.shared
+        
+        if await store.statistics(for: contentKey) != nil { return }
+        
+        let columnStatistics = await ColumnStatistics.statistics(of: parsedFile)
+        
+        // The file may have been evicted while the statistics were computed
+        guard await CacheManifest.shared.isStored(contentKey) else { return }
+        
+        await store.record(columnStatistics, for: contentKey)
+    }
+}
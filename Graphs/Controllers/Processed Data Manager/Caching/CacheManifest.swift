@@ -0,0 +1,601 @@
+//
+//  CacheManifest.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// Index of everything in the cache, loaded once and kept in memory.
+///
+/// For each Data Item the manifest records the signature its data file had when it was last parsed, and for each cached file (the parsed data and the graph) the format version, the versions of the data file, Parser Settings and Graph Template it was made from, its size and when it was last used.  Whether a cached file is up to date is answered from memory, without reading the cache directories.
+///
+/// Parsed files are stored by their ContentKey and shared by every Data Item with the same file content and Parser Settings.  A stored parsed file is counted once in the cache size and is released once no Data Item refers to it.
+///
+/// Data Items whose file changed since it was last parsed (found by the FileChangeMonitor or by `ProcessDataManager.scanForChangedFiles(in:)`) are marked stale until they are parsed again.
+///
+/// Changes are saved to a CacheManifestJournal shortly after they are made.
+@Observable
+@MainActor
+final class CacheManifest {
+    static let shared = CacheManifest()
+
+    /// Version of the encoded ParsedFile.  Cached files with another version are out of date.
+    ///
+    /// 2: ParsedFileArchive instead of JSON.
+    static let parsedFileFormatVersion = 2
+
+    /// Version of the cached graph files.
+    static let graphFormatVersion = 1
+
+    @ObservationIgnored
+    private var entries: [DataItem.LocalID : Entry] = [:]
+
+    /// Data Items whose file changed since it was last parsed.
+    private(set) var staleDataItemIDs: Set<DataItem.LocalID> = []
+
+    /// Size of the cached files of each kind.
+    private(set) var byteSizes: [Kind : Int] = [:]
+
+    /// Size of every cached file.
+    var totalByteSize: Int {
+        byteSizes.values.reduce(0, +)
+    }
+
+    /// Parsed files in the cache and the number of Data Items that refer to each one.
+    @ObservationIgnored
+    private var storedParsedFiles: [ContentKey : StoredParsedFile] = [:]
+
+    /// Files no Data Item refers to any more.  Collected with `takeReleasedFiles()` so that they can be deleted.
+    @ObservationIgnored
+    private var releasedFiles: [StoredFile] = []
+
+    /// Modification dates of the Graph Template files, read once per template.
+    @ObservationIgnored
+    private var graphTemplateVersions: [GraphTemplate.LocalID : Date] = [:]
+
+    /// Content keys computed while looking Data Items up in the cache, with the signature of the file they were computed from.  Used by the parse that follows a miss, so the file is hashed once.  Not saved.
+    @ObservationIgnored
+    private var lookedUpContentKeys: [DataItem.LocalID : (signature: FileSignature, contentKey: ContentKey)] = [:]
+
+
+    // Storage
+    /// Manifest changes are written once no further changes arrive within this delay.
+    static let saveDelay: Duration = .seconds(2)
+
+    @ObservationIgnored
+    private let journal: CacheManifestJournal
+
+    /// Data Items changed since the last save.
+    @ObservationIgnored
+    private var changedDataItemIDs: Set<DataItem.LocalID> = []
+
+    @ObservationIgnored
+    private var numberOfJournalRecords = 0
+
+    @ObservationIgnored
+    private var pendingSave: Task<Void, Never>?
+
+
+    private init() {
+        let snapshotURL = URL.cacheManifestURL
+        let journalURL = URL.cacheManifestJournalURL
+
+        let (loadedEntries, numberOfRecords) = CacheManifestJournal.load(snapshotURL: snapshotURL, journalURL: journalURL)
+
+        self.entries = loadedEntries
+        self.numberOfJournalRecords = numberOfRecords
+        self.journal = CacheManifestJournal(snapshotURL: snapshotURL, journalURL: journalURL)
+
+        for (nextID, nextEntry) in loadedEntries {
+            account(nextID, from: nil, to: nextEntry)
+        }
+    }
+
+
+
+    // MARK: - Source Files
+    func fileSignature(for dataItemID: DataItem.LocalID) -> FileSignature? {
+        entries[dataItemID]?.sourceSignature
+    }
+
+
+    /// Records the signature of the file that was parsed and clears the stale mark.
+    ///
+    /// - Parameter signature: Read before parsing, so that a change made during the parse is found by the next scan.
+    func recordParse(of dataItemID: DataItem.LocalID, signature: FileSignature?) {
+        if staleDataItemIDs.contains(dataItemID) {
+            staleDataItemIDs.remove(dataItemID)
+        }
+
+        if entries[dataItemID]?.sourceSignature == signature { return }
+
+        update(dataItemID) { $0.sourceSignature = signature }
+    }
+
+
+    func isStale(_ dataItemID: DataItem.LocalID) -> Bool {
+        staleDataItemIDs.contains(dataItemID)
+    }
+
+
+    func markStale(_ dataItemIDs: some Sequence<DataItem.LocalID>) {
+        let newIDs = Set(dataItemIDs).subtracting(staleDataItemIDs)
+
+        if newIDs.isEmpty { return }
+
+        staleDataItemIDs.formUnion(newIDs)
+    }
+
+
+
+    // MARK: - Graph Templates
+    /// Modification date of the Graph Template file.  Read from disk the first time and kept until `graphTemplateFileDidChange(_:)`.
+    func graphTemplateVersion(of graphTemplate: GraphTemplate) -> Date? {
+        if let version = graphTemplateVersions[graphTemplate.localID] { return version }
+
+        let version = graphTemplate.url.dateLastModified
+        graphTemplateVersions[graphTemplate.localID] = version
+
+        return version
+    }
+
+
+    func graphTemplateFileDidChange(_ graphTemplateID: GraphTemplate.LocalID) {
+        graphTemplateVersions.removeValue(forKey: graphTemplateID)
+    }
+
+
+
+    // MARK: - Cached Files
+    func cachedFile(_ kind: Kind, of dataItemID: DataItem.LocalID) -> CachedFile? {
+        entries[dataItemID]?[kind]
+    }
+
+
+    /// State of the cached ParsedFile.
+    ///
+    /// - Parameter parserSettingsVersion: `lastModified` of the Parser Settings the Data Item uses now.
+    func parsedFileState(of dataItemID: DataItem.LocalID, parserSettingsVersion: Date?) -> CachedState {
+        guard let entry = entries[dataItemID], let cachedFile = entry.parsedFile else { return .noCache }
+
+        guard let parserSettingsVersion else { return .cacheShouldBeRemoved }
+
+        if cachedFile.formatVersion != CacheManifest.parsedFileFormatVersion
+            || staleDataItemIDs.contains(dataItemID)
+            || cachedFile.sourceSignature != entry.sourceSignature
+            || cachedFile.parserSettingsVersion != parserSettingsVersion {
+            return .cacheNeedsUpdate
+        }
+
+        return .cachedStorageUpToDate
+    }
+
+
+    /// State of the cached graph.  A cached graph contains the parsed data, so it is also out of date when the Parser Settings changed.
+    ///
+    /// - Parameters:
+    ///   - graphTemplate: The Graph Template the Data Item uses now.
+    ///   - parserSettingsVersion: `lastModified` of the Parser Settings the Data Item uses now.
+    func graphState(of dataItemID: DataItem.LocalID, graphTemplate: GraphTemplate?, parserSettingsVersion: Date?) -> CachedState {
+        guard let entry = entries[dataItemID], let cachedFile = entry.graph else { return .noCache }
+
+        guard let graphTemplate else { return .cacheShouldBeRemoved }
+
+        if cachedFile.formatVersion != CacheManifest.graphFormatVersion
+            || staleDataItemIDs.contains(dataItemID)
+            || cachedFile.sourceSignature != entry.sourceSignature
+            || cachedFile.parserSettingsVersion != parserSettingsVersion
+            || cachedFile.graphTemplateID != graphTemplate.localID
+            || cachedFile.graphTemplateVersion != graphTemplateVersion(of: graphTemplate) {
+            return .cacheNeedsUpdate
+        }
+
+        return .cachedStorageUpToDate
+    }
+
+
+    /// Records a ParsedFile written to the cache under its ContentKey.  The file is made from the data file as it was last parsed.
+    func recordParsedFile(_ contentKey: ContentKey, of dataItemID: DataItem.LocalID, byteSize: Int, parserSettingsVersion: Date) {
+        update(dataItemID) { entry in
+            entry.parsedFile = CachedFile(formatVersion: CacheManifest.parsedFileFormatVersion,
+                                          sourceSignature: entry.sourceSignature,
+                                          parserSettingsVersion: parserSettingsVersion,
+                                          byteSize: byteSize,
+                                          lastAccess: .now,
+                                          contentKey: contentKey)
+        }
+    }
+
+
+    /// Records a graph written to the cache.  The graph is made from the data file as it was last parsed.
+    func recordGraph(of dataItemID: DataItem.LocalID, byteSize: Int, graphTemplate: GraphTemplate?, parserSettingsVersion: Date?) {
+        update(dataItemID) { entry in
+            entry.graph = CachedFile(formatVersion: CacheManifest.graphFormatVersion,
+                                     sourceSignature: entry.sourceSignature,
+                                     parserSettingsVersion: parserSettingsVersion,
+                                     graphTemplateID: graphTemplate?.localID,
+                                     graphTemplateVersion: graphTemplate.flatMap { graphTemplateVersion(of: $0) },
+                                     byteSize: byteSize,
+                                     lastAccess: .now)
+        }
+    }
+
+
+    /// True if a parsed file with the ContentKey is in the cache.
+    func isStored(_ contentKey: ContentKey) -> Bool {
+        storedParsedFiles[contentKey]?.formatVersion == CacheManifest.parsedFileFormatVersion
+    }
+
+
+    /// True if a parsed file of a data file with `byteCount` bytes is in the cache.  Checked before hashing a file to look up its ContentKey.
+    func hasStoredParsedFile(ofByteCount byteCount: Int64) -> Bool {
+        storedParsedFiles.contains { $0.key.byteCount == byteCount && $0.value.formatVersion == CacheManifest.parsedFileFormatVersion }
+    }
+
+
+    /// Keeps a ContentKey computed for a cache lookup that missed, so that caching the parse doesn't hash the file again.
+    func rememberContentKey(_ contentKey: ContentKey, of dataItemID: DataItem.LocalID, signature: FileSignature) {
+        lookedUpContentKeys[dataItemID] = (signature, contentKey)
+    }
+
+
+    /// The ContentKey remembered for the Data Item if the file still has `signature`.  The key is forgotten either way.
+    func takeContentKey(of dataItemID: DataItem.LocalID, signature: FileSignature) -> ContentKey? {
+        guard let lookedUp = lookedUpContentKeys.removeValue(forKey: dataItemID), lookedUp.signature == signature else { return nil }
+
+        return lookedUp.contentKey
+    }
+
+
+    /// Refers the Data Item to the stored parsed file with the ContentKey, e.g. when the same file is imported again.
+    ///
+    /// - Returns: False if no parsed file with the key is stored.
+    func adoptParsedFile(_ contentKey: ContentKey, for dataItemID: DataItem.LocalID, parserSettingsVersion: Date) -> Bool {
+        guard let storedParsedFile = storedParsedFiles[contentKey], storedParsedFile.formatVersion == CacheManifest.parsedFileFormatVersion else { return false }
+
+        recordParsedFile(contentKey, of: dataItemID, byteSize: storedParsedFile.byteSize, parserSettingsVersion: parserSettingsVersion)
+
+        return true
+    }
+
+
+    func recordAccess(_ kind: Kind, of dataItemID: DataItem.LocalID) {
+        guard entries[dataItemID]?[kind] != nil else { return }
+
+        update(dataItemID) { $0[kind]?.lastAccess = .now }
+    }
+
+
+    /// Files that no Data Item refers to since the last call.  The caller deletes them.
+    func takeReleasedFiles() -> [StoredFile] {
+        defer { releasedFiles = [] }
+
+        return releasedFiles
+    }
+
+
+    /// Forgets the cached files of the Data Items and returns the files that no Data Item refers to any more, so that they can be deleted.
+    func removeCachedFiles(of dataItemIDs: some Sequence<DataItem.LocalID>) -> [StoredFile] {
+        for nextID in dataItemIDs {
+            guard let entry = entries[nextID], entry.parsedFile != nil || entry.graph != nil else { continue }
+
+            update(nextID) {
+                $0.parsedFile = nil
+                $0.graph = nil
+            }
+        }
+
+        return takeReleasedFiles()
+    }
+
+
+    /// Forgets the parsed file with the ContentKey for every Data Item that refers to it, e.g. because it is missing from the cache directory.
+    func removeParsedFile(_ contentKey: ContentKey) {
+        for (nextID, nextEntry) in entries where nextEntry.parsedFile?.contentKey == contentKey {
+            update(nextID) { $0.parsedFile = nil }
+        }
+    }
+
+
+    /// Forgets every cached file.  The signatures of the data files are kept.
+    func removeAllCachedFiles() {
+        for (nextID, nextEntry) in entries where nextEntry.parsedFile != nil || nextEntry.graph != nil {
+            update(nextID) {
+                $0.parsedFile = nil
+                $0.graph = nil
+            }
+        }
+
+        releasedFiles = []
+    }
+
+
+    /// Forgets everything about the Data Items, e.g. after they are deleted.
+    func removeEntries(for dataItemIDs: [DataItem.LocalID]) {
+        for nextID in dataItemIDs {
+            lookedUpContentKeys.removeValue(forKey: nextID)
+
+            guard let entry = entries.removeValue(forKey: nextID) else { continue }
+
+            account(nextID, from: entry, to: nil)
+            changedDataItemIDs.insert(nextID)
+        }
+
+        if !staleDataItemIDs.isDisjoint(with: dataItemIDs) {
+            staleDataItemIDs.subtract(dataItemIDs)
+        }
+
+        scheduleSave()
+    }
+
+
+
+    // MARK: - Eviction
+    /// Forgets the least recently used stored files until `byteSize` bytes are freed, and returns them so that they can be deleted.
+    ///
+    /// A shared parsed file is used as recently as the most recent of the Data Items that refer to it, and is evicted for all of them.
+    func removeLeastRecentlyUsedFiles(freeing byteSize: Int) -> [StoredFile] {
+        if byteSize <= 0 { return [] }
+
+        var lastAccesses: [StoredFile : Date] = [:]
+        var referringDataItemIDs: [StoredFile : [DataItem.LocalID]] = [:]
+
+        for (nextID, nextEntry) in entries {
+            if let parsedFile = nextEntry.parsedFile, let contentKey = parsedFile.contentKey {
+                let storedFile = StoredFile.parsedFile(contentKey)
+                lastAccesses[storedFile] = max(lastAccesses[storedFile] ?? .distantPast, parsedFile.lastAccess)
+                referringDataItemIDs[storedFile, default: []].append(nextID)
+            }
+
+            if let graph = nextEntry.graph {
+                lastAccesses[.graph(nextID)] = graph.lastAccess
+                referringDataItemIDs[.graph(nextID)] = [nextID]
+            }
+        }
+
+        let storedFilesByAge = lastAccesses.sorted { $0.value < $1.value }.map { $0.key }
+
+        let initialByteSize = totalByteSize
+
+        for nextStoredFile in storedFilesByAge {
+            if initialByteSize - totalByteSize >= byteSize { break }
+
+            for nextID in referringDataItemIDs[nextStoredFile] ?? [] {
+                switch nextStoredFile {
+                case .parsedFile: update(nextID) { $0.parsedFile = nil }
+                case .graph: update(nextID) { $0.graph = nil }
+                }
+            }
+        }
+
+        return takeReleasedFiles()
+    }
+
+
+    /// Forgets the entries of Data Items that no longer exist and returns the files no Data Item refers to any more, so that they can be deleted.
+    func removeOrphans(keeping existingDataItemIDs: Set<DataItem.LocalID>) -> [StoredFile] {
+        let orphanIDs = entries.keys.filter { !existingDataItemIDs.contains($0) }
+
+        if orphanIDs.isEmpty { return [] }
+
+        removeEntries(for: orphanIDs)
+
+        return takeReleasedFiles()
+    }
+
+
+    /// Every file in the cache.
+    var allStoredFiles: [StoredFile] {
+        storedParsedFiles.keys.map { StoredFile.parsedFile($0) } + entries.compactMap { $0.value.graph == nil ? nil : StoredFile.graph($0.key) }
+    }
+
+
+
+    // MARK: - Updating
+    private func update(_ dataItemID: DataItem.LocalID, _ body: (inout Entry) -> Void) {
+        var entry = entries[dataItemID] ?? Entry()
+        let oldEntry = entries[dataItemID]
+
+        body(&entry)
+
+        entries[dataItemID] = entry
+        changedDataItemIDs.insert(dataItemID)
+
+        account(dataItemID, from: oldEntry, to: entry)
+
+        scheduleSave()
+    }
+
+
+    /// Updates the reference counts and sizes for an entry that changed from `oldEntry` to `newEntry`.
+    private func account(_ dataItemID: DataItem.LocalID, from oldEntry: Entry?, to newEntry: Entry?) {
+        let oldParsedFile = oldEntry?.parsedFile
+        let newParsedFile = newEntry?.parsedFile
+
+        if oldParsedFile?.contentKey != newParsedFile?.contentKey {
+            if let oldContentKey = oldParsedFile?.contentKey {
+                release(oldContentKey)
+            }
+
+            if let newParsedFile, let newContentKey = newParsedFile.contentKey {
+                retain(newContentKey, byteSize: newParsedFile.byteSize, formatVersion: newParsedFile.formatVersion)
+            }
+        }
+
+        let oldGraphByteSize = oldEntry?.graph?.byteSize ?? 0
+        let newGraphByteSize = newEntry?.graph?.byteSize ?? 0
+
+        if oldGraphByteSize != newGraphByteSize {
+            byteSizes[.graph, default: 0] += newGraphByteSize - oldGraphByteSize
+        }
+
+        if oldEntry?.graph != nil && newEntry?.graph == nil {
+            releasedFiles.append(.graph(dataItemID))
+        }
+    }
+
+
+    private func retain(_ contentKey: ContentKey, byteSize: Int, formatVersion: Int) {
+        if let storedParsedFile = storedParsedFiles[contentKey] {
+            storedParsedFiles[contentKey]?.referenceCount = storedParsedFile.referenceCount + 1
+
+            // A newer format replaces the stored file under the same key
+            if storedParsedFile.byteSize != byteSize || storedParsedFile.formatVersion != formatVersion {
+                byteSizes[.parsedFile, default: 0] += byteSize - storedParsedFile.byteSize
+                storedParsedFiles[contentKey]?.byteSize = byteSize
+                storedParsedFiles[contentKey]?.formatVersion = formatVersion
+            }
+        } else {
+            storedParsedFiles[contentKey] = StoredParsedFile(referenceCount: 1, byteSize: byteSize, formatVersion: formatVersion)
+            byteSizes[.parsedFile, default: 0] += byteSize
+        }
+    }
+
+
+    private func release(_ contentKey: ContentKey) {
+        guard let storedParsedFile = storedParsedFiles[contentKey] else { return }
+
+        if storedParsedFile.referenceCount > 1 {
+            storedParsedFiles[contentKey]?.referenceCount = storedParsedFile.referenceCount - 1
+        } else {
+            storedParsedFiles.removeValue(forKey: contentKey)
+            byteSizes[.parsedFile, default: 0] -= storedParsedFile.byteSize
+            releasedFiles.append(.parsedFile(contentKey))
+        }
+    }
+
+
+
+    // MARK: - Storage
+    private func scheduleSave() {
+        pendingSave?.cancel()
+
+        pendingSave = Task {
+            try? await Task.sleep(for: CacheManifest.saveDelay)
+
+            if Task.isCancelled { return }
+
+            guard let write = self.takeChanges() else { return }
+
+            await Task.detached(priority: .utility) { write() }.value
+        }
+    }
+
+
+    /// Writes the pending changes before returning, e.g. when the app quits.
+    func flush() {
+        pendingSave?.cancel()
+        pendingSave = nil
+
+        takeChanges()?()
+    }
+
+
+    /// Takes the changed entries and returns the write that saves them: appending them to the journal, or writing a new snapshot once the journal is larger than the manifest.
+    private func takeChanges() -> (@Sendable () -> Void)? {
+        if changedDataItemIDs.isEmpty { return nil }
+
+        let records: [CacheManifestJournal.Record] = changedDataItemIDs.map { nextID in
+            if let entry = entries[nextID] {
+                return .update(nextID, entry)
+            } else {
+                return .remove(nextID)
+            }
+        }
+
+        changedDataItemIDs.removeAll()
+
+        let localJournal = journal
+
+        if numberOfJournalRecords + records.count > max(entries.count, 1_000) {
+            numberOfJournalRecords = 0
+
+            let localEntries = entries
+            return { localJournal.writeSnapshot(localEntries) }
+        } else {
+            numberOfJournalRecords += records.count
+
+            return { localJournal.append(records) }
+        }
+    }
+}
+
+
+
+// MARK: - Entries
+extension CacheManifest {
+
+    enum Kind: CaseIterable, Sendable {
+        case parsedFile
+        case graph
+    }
+
+
+    /// A file in the cache directories.
+    enum StoredFile: Hashable, Sendable {
+        case parsedFile(ContentKey)
+        case graph(DataItem.LocalID)
+    }
+
+
+    /// A parsed file in the cache and the number of Data Items that refer to it.
+    private struct StoredParsedFile {
+        var referenceCount: Int
+        var byteSize: Int
+        var formatVersion: Int
+    }
+
+
+    /// Everything the manifest records about one Data Item.
+    struct Entry: Codable, Sendable, Equatable {
+        /// Signature of the data file when it was last parsed.
+        var sourceSignature: FileSignature?
+
+        var parsedFile: CachedFile?
+
+        var graph: CachedFile?
+
+        subscript(kind: Kind) -> CachedFile? {
+            get {
+                switch kind {
+                case .parsedFile: return parsedFile
+                case .graph: return graph
+                }
+            }
+            set {
+                switch kind {
+                case .parsedFile: parsedFile = newValue
+                case .graph: graph = newValue
+                }
+            }
+        }
+    }
+
+
+    /// A file in the cache and what it was made from.
+    struct CachedFile: Codable, Sendable, Equatable {
+        var formatVersion: Int
+
+        /// Signature of the data file the cached file was made from.
+        var sourceSignature: FileSignature?
+
+        /// `lastModified` of the Parser Settings used to parse the data file.
+        var parserSettingsVersion: Date?
+
+        var graphTemplateID: GraphTemplate.LocalID?
+
+        /// Modification date of the Graph Template file used to make the graph.
+        var graphTemplateVersion: Date?
+
+        var byteSize: Int
+
+        var lastAccess: Date
+
+        /// Key of the stored parsed file, which may be shared with other Data Items.
+        var contentKey: ContentKey?
+    }
+}
@@ -0,0 +1,253 @@
+//
+//  CacheManifestJournal.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+import OSLog
+
+
+/// Stores the CacheManifest as a snapshot and a journal of the changes made since the snapshot.
+///
+/// Changes are appended to the journal as length prefixed, checksummed binary property lists, so a save only writes what changed.  The snapshot is replaced atomically when the journal grows, and the journal is emptied afterwards.  Replaying a record is idempotent, so a crash at any point loses at most the records that were not completely written.  They are found by their checksum when the journal is loaded, and the journal is truncated before them.
+///
+/// Writes are serialized by a lock, so they can run on a background task or, when the app quits, synchronously.
+final class CacheManifestJournal: @unchecked Sendable {
+
+    /// A change of the manifest.
+    enum Record: Codable, Sendable {
+        case update(DataItem.LocalID, CacheManifest.Entry)
+        case remove(DataItem.LocalID)
+    }
+
+
+    private struct Snapshot: Codable {
+        /// Version of the snapshot and record layout.  Files with another version are discarded.
+        var version: Int
+        var entries: [DataItem.LocalID : CacheManifest.Entry]
+    }
+
+
+    /// 3: ContentKeys hold SHA-256 digests.
+    static let version = 3
+
+    let snapshotURL: URL
+
+    let journalURL: URL
+
+    private let lock = NSLock()
+
+
+    init(snapshotURL: URL, journalURL: URL) {
+        self.snapshotURL = snapshotURL
+        self.journalURL = journalURL
+    }
+
+
+
+    // MARK: - Loading
+    /// Reads the snapshot and replays the journal.
+    ///
+    /// A torn or corrupt record ends the replay, and the journal is truncated before it, so that the records appended later are replayed at the next launch instead of being hidden behind the broken bytes.
+    ///
+    /// - Returns: The entries and the number of journal records that were replayed.
+    static func load(snapshotURL: URL, journalURL: URL) -> (entries: [DataItem.LocalID : CacheManifest.Entry], numberOfRecords: Int) {
+        var entries: [DataItem.LocalID : CacheManifest.Entry] = [:]
+
+        if let data = try? Data(contentsOf: snapshotURL, options: .alwaysMapped) {
+            if let snapshot = try? PropertyListDecoder().decode(Snapshot.self, from: data), snapshot.version == version {
+                entries = snapshot.entries
+            } else {
+                Logger.processingData.info("Discarding unreadable cache manifest at: \(snapshotURL.path())")
+            }
+        }
+
+        guard let replay = replayJournal(at: journalURL, into: &entries) else {
+            return (entries, 0)
+        }
+
+        if replay.validByteCount < replay.journalByteCount {
+            Logger.processingData.info("Truncating the cache manifest journal after \(replay.numberOfRecords) valid records")
+
+            if !truncateJournal(at: journalURL, toByteCount: replay.validByteCount) {
+                // A new snapshot contains the replayed records and empties the journal
+                CacheManifestJournal(snapshotURL: snapshotURL, journalURL: journalURL).writeSnapshot(entries)
+            }
+        }
+
+        return (entries, replay.numberOfRecords)
+    }
+
+
+    /// Applies the valid records of the journal to `entries`.
+    ///
+    /// - Returns: The number of replayed records, the number of bytes up to the end of the last valid record and the size of the journal, or nil if there is no journal.
+    private static func replayJournal(at journalURL: URL, into entries: inout [DataItem.LocalID : CacheManifest.Entry]) -> (numberOfRecords: Int, validByteCount: Int, journalByteCount: Int)? {
+        guard let journal = try? Data(contentsOf: journalURL, options: .alwaysMapped) else { return nil }
+
+        let decoder = PropertyListDecoder()
+        var numberOfRecords = 0
+        var offset = journal.startIndex
+
+        while true {
+            var nextOffset = offset
+
+            guard let nextPayload = nextRecordPayload(in: journal, at: &nextOffset),
+                  let record = try? decoder.decode(Record.self, from: nextPayload) else { break }
+
+            switch record {
+            case .update(let dataItemID, let entry): entries[dataItemID] = entry
+            case .remove(let dataItemID): entries.removeValue(forKey: dataItemID)
+            }
+
+            offset = nextOffset
+            numberOfRecords += 1
+        }
+
+        return (numberOfRecords, offset - journal.startIndex, journal.count)
+    }
+
+
+    /// - Returns: False if the journal could not be truncated.
+    private static func truncateJournal(at journalURL: URL, toByteCount byteCount: Int) -> Bool {
+        do {
+            let handle = try FileHandle(forWritingTo: journalURL)
+            defer { try? handle.close() }
+
+            try handle.truncate(atOffset: UInt64(byteCount))
+
+            return true
+        } catch {
+            Logger.processingData.error("Could not truncate the cache manifest journal at: \(journalURL.path())")
+            Logger.processingData.error("\(error.localizedDescription)")
+
+            return false
+        }
+    }
+
+
+    /// The payload of the record at `offset`, or nil at the end of the journal or at an incomplete or corrupt record.
+    private static func nextRecordPayload(in journal: Data, at offset: inout Data.Index) -> Data? {
+        let headerSize = 8
+
+        guard journal.endIndex - offset >= headerSize else { return nil }
+
+        let length = Int(readUInt32(journal, at: offset))
+        let checksum = readUInt32(journal, at: offset + 4)
+
+        let payloadStart = offset + headerSize
+
+        guard length > 0, journal.endIndex - payloadStart >= length else { return nil }
+
+        let payload = journal[payloadStart ..< payloadStart + length]
+
+        guard CacheManifestJournal.checksum(of: payload) == checksum else { return nil }
+
+        offset = payloadStart + length
+
+        return payload
+    }
+
+
+
+    // MARK: - Writing
+    /// Appends the records to the journal.
+    func append(_ records: [Record]) {
+        if records.isEmpty { return }
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        let encoder = PropertyListEncoder()
+        encoder.outputFormat = .binary
+
+        var data = Data()
+
+        for nextRecord in records {
+            guard let payload = try? encoder.encode(nextRecord) else { continue }
+
+            appendUInt32(UInt32(payload.count), to: &data)
+            appendUInt32(CacheManifestJournal.checksum(of: payload), to: &data)
+            data.append(payload)
+        }
+
+        do {
+            try createDirectory()
+
+            if !FileManager.default.fileExists(atPath: journalURL.path(percentEncoded: false)) {
+                try Data().write(to: journalURL)
+            }
+
+            let handle = try FileHandle(forWritingTo: journalURL)
+            defer { try? handle.close() }
+
+            try handle.seekToEnd()
+            try handle.write(contentsOf: data)
+        } catch {
+            Logger.processingData.error("Could not append to the cache manifest journal at: \(self.journalURL.path())")
+            Logger.processingData.error("\(error.localizedDescription)")
+        }
+    }
+
+
+    /// Replaces the snapshot with `entries` and empties the journal.
+    func writeSnapshot(_ entries: [DataItem.LocalID : CacheManifest.Entry]) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        let encoder = PropertyListEncoder()
+        encoder.outputFormat = .binary
+
+        do {
+            try createDirectory()
+
+            let data = try encoder.encode(Snapshot(version: CacheManifestJournal.version, entries: entries))
+            try data.write(to: snapshotURL, options: .atomic)
+
+            // The snapshot already contains every record, so a crash before this line only replays them again
+            try Data().write(to: journalURL, options: .atomic)
+        } catch {
+            Logger.processingData.error("Could not save the cache manifest to: \(self.snapshotURL.path())")
+            Logger.processingData.error("\(error.localizedDescription)")
+        }
+    }
+
+
+    private func createDirectory() throws {
+        try FileManager.default.createDirectory(at: snapshotURL.deletingLastPathComponent(), withIntermediateDirectories: true)
+    }
+
+
+
+    // MARK: - Encoding
+    private func appendUInt32(_ value: UInt32, to data: inout Data) {
+        withUnsafeBytes(of: value.littleEndian) { data.append(contentsOf: $0) }
+    }
+
+
+    private static func readUInt32(_ data: Data, at offset: Data.Index) -> UInt32 {
+        var value: UInt32 = 0
+
+        for nextByte in 0 ..< 4 {
+            value |= UInt32(data[offset + nextByte]) << (8 * UInt32(nextByte))
+        }
+
+        return value
+    }
+
+
+    /// 32 bit FNV-1a hash of the bytes.
+    private static func checksum(of bytes: Data) -> UInt32 {
+        var hash: UInt32 = 2_166_136_261
+
+        for nextByte in bytes {
+            hash ^= UInt32(nextByte)
+            hash = hash &* 16_777_619
+        }
+
+        return hash
+    }
+}
@@ -0,0 +1,77 @@
+//
+//  ContentKey.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+import CryptoKit
+
+
+/// Identifies a parsed file by what it was made from: the bytes of the data file and the Parser Settings.
+///
+/// Data Items that import the same file (e.g. into another folder, or again after it was moved) and parse it with equal Parser Settings have the same key, so they share one cached ParsedFile.
+struct ContentKey: Codable, Hashable, Sendable {
+
+    var byteCount: Int64
+
+    /// SHA-256 digest of the data file, in hexadecimal.
+    var fileDigest: String
+
+    /// SHA-256 digest of the settings that change how the file is parsed, in hexadecimal.
+    var parserSettingsDigest: String
+
+
+    /// Nil if the file can't be read.
+    init?(fileAt url: URL, parserSettings: ParserSettingsStatic) {
+        guard let data = try? Data(contentsOf: url, options: .alwaysMapped) else { return nil }
+
+        self.byteCount = Int64(data.count)
+        self.fileDigest = ContentKey.digest(of: data)
+        self.parserSettingsDigest = ContentKey.fingerprint(of: parserSettings)
+    }
+
+
+    /// The key of the same file parsed with other Parser Settings, without reading the file again.
+    func parsed(with parserSettings: ParserSettingsStatic) -> ContentKey {
+        var output = self
+        output.parserSettingsDigest = ContentKey.fingerprint(of: parserSettings)
+
+        return output
+    }
+
+
+    /// Name of the cached file.
+    var fileName: String {
+        fileDigest + "-" + parserSettingsDigest + "-" + String(byteCount)
+    }
+
+
+
+    // MARK: - Hashing
+    /// Digest of the settings that change how a file is parsed.  The name, ID and dates are left out so that equal settings match.
+    private static func fingerprint(of parserSettings: ParserSettingsStatic) -> String {
+        var settings = parserSettings
+        settings.name = ""
+        settings.localID.id = UUID(uuid: UUID_NULL)
+        settings.creationDate = .distantPast
+        settings.lastModified = .distantPast
+
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = .sortedKeys
+
+        guard let data = try? encoder.encode(settings) else { return "" }
+
+        return digest(of: data)
+    }
+
+
+    /// SHA-256 digest of the bytes, in hexadecimal.
+    ///
+    /// The key decides which cached ParsedFile a Data Item is given, so a collision would show the data of another file.  A cryptographic digest makes that practically impossible.
+    private static func digest(of data: Data) -> String {
+        SHA256.hash(data: data).map { String(format: "%02x", $0) }.joined()
+    }
+}
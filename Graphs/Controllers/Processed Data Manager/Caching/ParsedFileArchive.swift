@@ -0,0 +1,267 @@
+//
+//  ParsedFileArchive.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// Binary format of a cached ParsedFile.
+///
+/// Every column is stored in blocks of `rowsPerBlock` rows.  Each block is transformed by the cheapest encoding that fits its values (integer deltas, XOR of the previous double, a dictionary of repeated strings, or plain strings) and then compressed, so that numeric columns take a fraction of their text size.  Blocks can be decoded on their own, so `column(at:rows:)` only decompresses the blocks that overlap the requested rows.
+///
+/// The file starts with a fixed header, followed by the layout (the ParsedFile without column values, and the position of every block) and the blocks:
+///
+///     magic (4) | version (4) | layout length (4) | layout flags (1) | layout | blocks
+struct ParsedFileArchive {
+
+    static let magic: UInt32 = 0x4146_5047 // "GPFA"
+
+    static let version: UInt32 = 1
+
+    static let rowsPerBlock = 4096
+
+    private static let headerSize = 13
+
+
+    enum ArchiveError: Error {
+        case notAnArchive
+        case unsupportedVersion
+        case corruptBlock
+    }
+
+
+    /// Transform applied to the values of a block before it is compressed.
+    enum Encoding: UInt8, Codable {
+        case strings
+        case dictionary
+        case integers
+        case doubles
+    }
+
+
+    struct Block: Codable {
+        /// Offset from the start of the blocks.
+        var offset: Int
+        var length: Int
+        var numberOfRows: Int
+        var encoding: Encoding
+        var isCompressed: Bool
+    }
+
+
+    private struct Layout: Codable {
+        /// The ParsedFile with empty columns.
+        var parsedFile: ParsedFile
+        var columns: [[Block]]
+    }
+
+
+    private let data: Data
+
+    private let layout: Layout
+
+    private let blocksStart: Int
+
+
+    var numberOfColumns: Int {
+        layout.columns.count
+    }
+
+
+
+    // MARK: - Encoding
+    static func encode(_ parsedFile: ParsedFile) throws -> Data {
+        var blocks = Data()
+        var columnBlocks: [[Block]] = []
+
+        for nextColumn in parsedFile.data {
+            var nextBlocks: [Block] = []
+
+            for nextStart in stride(from: 0, to: nextColumn.data.count, by: rowsPerBlock) {
+                let values = nextColumn.data[nextStart ..< min(nextStart + rowsPerBlock, nextColumn.data.count)]
+
+                let (encoding, payload) = encodeBlock(values)
+                let compressedPayload = compress(payload)
+
+                nextBlocks.append(Block(offset: blocks.count,
+                                        length: compressedPayload?.count ?? payload.count,
+                                        numberOfRows: values.count,
+                                        encoding: encoding,
+                                        isCompressed: compressedPayload != nil))
+
+                blocks.append(compressedPayload ?? payload)
+            }
+
+            columnBlocks.append(nextBlocks)
+        }
+
+        var emptyParsedFile = parsedFile
+        emptyParsedFile.data = parsedFile.data.map { nextColumn in
+            var emptyColumn = DataColumn(header: nextColumn.header, data: [])
+            emptyColumn.id = nextColumn.id
+            return emptyColumn
+        }
+
+        let encoder = PropertyListEncoder()
+        encoder.outputFormat = .binary
+
+        let layoutData = try encoder.encode(Layout(parsedFile: emptyParsedFile, columns: columnBlocks))
+        let compressedLayoutData = compress(layoutData)
+        let storedLayoutData = compressedLayoutData ?? layoutData
+
+        var output = Data(capacity: headerSize + storedLayoutData.count + blocks.count)
+        appendUInt32(magic, to: &output)
+        appendUInt32(version, to: &output)
+        appendUInt32(UInt32(storedLayoutData.count), to: &output)
+        output.append(compressedLayoutData == nil ? 0 : 1)
+        output.append(storedLayoutData)
+        output.append(blocks)
+
+        return output
+    }
+
+
+
+    // MARK: - Decoding
+    /// Reads the layout.  Blocks are only read when their column is requested.
+    ///
+    /// - Parameter data: Preferably memory mapped, so that unread blocks are never loaded.
+    init(data: Data) throws {
+        guard data.count >= ParsedFileArchive.headerSize,
+              ParsedFileArchive.readUInt32(data, at: 0) == ParsedFileArchive.magic else {
+            throw ArchiveError.notAnArchive
+        }
+
+        guard ParsedFileArchive.readUInt32(data, at: 4) == ParsedFileArchive.version else {
+            throw ArchiveError.unsupportedVersion
+        }
+
+        let layoutLength = Int(ParsedFileArchive.readUInt32(data, at: 8))
+        let isLayoutCompressed = data[data.startIndex + 12] == 1
+        let layoutStart = data.startIndex + ParsedFileArchive.headerSize
+
+        guard data.endIndex - layoutStart >= layoutLength else { throw ArchiveError.corruptBlock }
+
+        var layoutData = data[layoutStart ..< layoutStart + layoutLength]
+
+        if isLayoutCompressed {
+            layoutData = try ParsedFileArchive.decompress(layoutData)
+        }
+
+        self.data = data
+        self.layout = try PropertyListDecoder().decode(Layout.self, from: layoutData)
+        self.blocksStart = layoutStart + layoutLength
+    }
+
+
+    /// The values of the column.
+    ///
+    /// - Parameter rows: Rows to decode.  Only the blocks that overlap the rows are decompressed.  Nil for every row.
+    func column(at index: Int, rows: Range<Int>? = nil) throws -> [String] {
+        let blocks = layout.columns[index]
+
+        let numberOfRows = blocks.reduce(0) { $0 + $1.numberOfRows }
+        let requestedRows = (rows ?? 0 ..< numberOfRows).clamped(to: 0 ..< numberOfRows)
+
+        if requestedRows.isEmpty { return [] }
+
+        var output: [String] = []
+        output.reserveCapacity(requestedRows.count)
+
+        var blockStart = 0
+
+        for nextBlock in blocks {
+            let blockRows = blockStart ..< blockStart + nextBlock.numberOfRows
+            blockStart += nextBlock.numberOfRows
+
+            guard blockRows.overlaps(requestedRows) else { continue }
+
+            let values = try decodeBlock(nextBlock)
+            let overlap = blockRows.clamped(to: requestedRows)
+
+            output.append(contentsOf: values[(overlap.lowerBound - blockRows.lowerBound) ..< (overlap.upperBound - blockRows.lowerBound)])
+        }
+
+        return output
+    }
+
+
+    /// The ParsedFile with every column.
+    func parsedFile() throws -> ParsedFile {
+        var output = layout.parsedFile
+
+        for (nextIndex, nextColumn) in output.data.enumerated() {
+            var filledColumn = DataColumn(header: nextColumn.header, data: try column(at: nextIndex))
+            filledColumn.id = nextColumn.id
+
+            output.data[nextIndex] = filledColumn
+        }
+
+        return output
+    }
+
+
+    private func decodeBlock(_ block: Block) throws -> [String] {
+        let start = blocksStart + block.offset
+
+        guard block.offset >= 0, block.length >= 0, data.endIndex - start >= block.length else {
+            throw ArchiveError.corruptBlock
+        }
+
+        var payload = data[start ..< start + block.length]
+
+        if block.isCompressed {
+            payload = try ParsedFileArchive.decompress(payload)
+        }
+
+        return try ParsedFileArchive.decodeBlock(payload, encoding: block.encoding, numberOfRows: block.numberOfRows)
+    }
+
+
+
+    // MARK: - Compression
+    /// The compressed data, or nil if compression is unavailable or doesn't make the data smaller.
+    private static func compress(_ data: Data) -> Data? {
+        #if canImport(Compression)
+        guard let compressedData = try? (data as NSData).compressed(using: .lzfse) as Data,
+              compressedData.count < data.count else {
+            return nil
+        }
+
+        return compressedData
+        #else
+        return nil
+        #endif
+    }
+
+
+    private static func decompress(_ data: Data) throws -> Data {
+        #if canImport(Compression)
+        return try (data as NSData).decompressed(using: .lzfse) as Data
+        #else
+        throw ArchiveError.corruptBlock
+        #endif
+    }
+
+
+
+    // MARK: - Header
+    private static func appendUInt32(_ value: UInt32, to data: inout Data) {
+        withUnsafeBytes(of: value.littleEndian) { data.append(contentsOf: $0) }
+    }
+
+
+    private static func readUInt32(_ data: Data, at offset: Int) -> UInt32 {
+        var value: UInt32 = 0
+
+        for nextByte in 0 ..< 4 {
+            value |= UInt32(data[data.startIndex + offset + nextByte]) << (8 * UInt32(nextByte))
+        }
+
+        return value
+    }
+}
@@ -0,0 +1,260 @@
+//
+//  ParsedFileArchive_Encodings.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+// MARK: - Block Encodings
+/// Each encoding reproduces the original strings exactly.  A value that the integer or double encodings would write differently (e.g. "007" or "1.50") makes the block fall back to the next encoding.
+extension ParsedFileArchive {
+
+    /// Dictionaries are limited to one byte per index.
+    static let maximumDictionarySize = 255
+
+
+    static func encodeBlock(_ values: ArraySlice<String>) -> (Encoding, Data) {
+        if let payload = encodeIntegers(values) { return (.integers, payload) }
+
+        if let payload = encodeDoubles(values) { return (.doubles, payload) }
+
+        if let payload = encodeDictionary(values) { return (.dictionary, payload) }
+
+        return (.strings, encodeStrings(values))
+    }
+
+
+    static func decodeBlock(_ payload: Data, encoding: Encoding, numberOfRows: Int) throws -> [String] {
+        try payload.withUnsafeBytes { bytes in
+            var reader = ByteReader(bytes: bytes)
+            var output: [String] = []
+            output.reserveCapacity(numberOfRows)
+
+            switch encoding {
+            case .integers:
+                var previousValue: Int64 = 0
+
+                for _ in 0 ..< numberOfRows {
+                    let difference = try reader.readVarint()
+                    previousValue = previousValue &+ zigzagDecoded(difference)
+                    output.append(String(previousValue))
+                }
+
+            case .doubles:
+                var previousBits: UInt64 = 0
+
+                for _ in 0 ..< numberOfRows {
+                    let bits = try reader.readUInt64()
+                    previousBits ^= bits
+                    output.append(String(Double(bitPattern: previousBits)))
+                }
+
+            case .dictionary:
+                let numberOfEntries = Int(clamping: try reader.readVarint())
+
+                guard numberOfEntries <= maximumDictionarySize else { throw ArchiveError.corruptBlock }
+
+                var dictionary: [String] = []
+
+                for _ in 0 ..< numberOfEntries {
+                    dictionary.append(try reader.readString())
+                }
+
+                for _ in 0 ..< numberOfRows {
+                    let index = Int(try reader.readUInt8())
+
+                    guard index < dictionary.count else { throw ArchiveError.corruptBlock }
+
+                    output.append(dictionary[index])
+                }
+
+            case .strings:
+                for _ in 0 ..< numberOfRows {
+                    output.append(try reader.readString())
+                }
+            }
+
+            return output
+        }
+    }
+
+
+
+    // MARK: - Integers
+    /// Differences between neighbouring values, so that counters and timestamps become runs of small numbers.
+    private static func encodeIntegers(_ values: ArraySlice<String>) -> Data? {
+        var output = Data()
+        var previousValue: Int64 = 0
+
+        for nextString in values {
+            guard let value = Int64(nextString), String(value) == nextString else { return nil }
+
+            appendVarint(zigzagEncoded(value &- previousValue), to: &output)
+            previousValue = value
+        }
+
+        return output
+    }
+
+
+    private static func zigzagEncoded(_ value: Int64) -> UInt64 {
+        UInt64(bitPattern: (value << 1) ^ (value >> 63))
+    }
+
+
+    private static func zigzagDecoded(_ value: UInt64) -> Int64 {
+        Int64(bitPattern: value >> 1) ^ -Int64(bitPattern: value & 1)
+    }
+
+
+
+    // MARK: - Doubles
+    /// Bits of each value XORed with the previous value, so that the shared sign, exponent and leading mantissa bits of smooth data become zeros.
+    private static func encodeDoubles(_ values: ArraySlice<String>) -> Data? {
+        var output = Data(capacity: values.count * 8)
+        var previousBits: UInt64 = 0
+
+        for nextString in values {
+            guard let value = Double(nextString), String(value) == nextString else { return nil }
+
+            let bits = value.bitPattern
+            withUnsafeBytes(of: (bits ^ previousBits).littleEndian) { output.append(contentsOf: $0) }
+            previousBits = bits
+        }
+
+        return output
+    }
+
+
+
+    // MARK: - Strings
+    private static func encodeDictionary(_ values: ArraySlice<String>) -> Data? {
+        var indices: [String : UInt8] = [:]
+        var dictionary: [String] = []
+        var indexBytes: [UInt8] = []
+        indexBytes.reserveCapacity(values.count)
+
+        for nextString in values {
+            if let index = indices[nextString] {
+                indexBytes.append(index)
+                continue
+            }
+
+            guard dictionary.count < maximumDictionarySize else { return nil }
+
+            let index = UInt8(dictionary.count)
+            indices[nextString] = index
+            dictionary.append(nextString)
+            indexBytes.append(index)
+        }
+
+        // A dictionary only pays off if values repeat
+        guard dictionary.count * 2 <= values.count else { return nil }
+
+        var output = Data()
+        appendVarint(UInt64(dictionary.count), to: &output)
+
+        for nextString in dictionary {
+            appendString(nextString, to: &output)
+        }
+
+        output.append(contentsOf: indexBytes)
+
+        return output
+    }
+
+
+    private static func encodeStrings(_ values: ArraySlice<String>) -> Data {
+        var output = Data()
+
+        for nextString in values {
+            appendString(nextString, to: &output)
+        }
+
+        return output
+    }
+
+
+    private static func appendString(_ string: String, to data: inout Data) {
+        let utf8 = Array(string.utf8)
+
+        appendVarint(UInt64(utf8.count), to: &data)
+        data.append(contentsOf: utf8)
+    }
+
+
+    private static func appendVarint(_ value: UInt64, to data: inout Data) {
+        var remainingValue = value
+
+        while remainingValue >= 0x80 {
+            data.append(UInt8(truncatingIfNeeded: remainingValue) | 0x80)
+            remainingValue >>= 7
+        }
+
+        data.append(UInt8(remainingValue))
+    }
+}
+
+
+
+// MARK: - Byte Reader
+extension ParsedFileArchive {
+
+    /// Reads the values of a block, throwing instead of reading past its end.
+    private struct ByteReader {
+        let bytes: UnsafeRawBufferPointer
+
+        var offset = 0
+
+
+        mutating func readUInt8() throws -> UInt8 {
+            guard offset < bytes.count else { throw ArchiveError.corruptBlock }
+
+            defer { offset += 1 }
+
+            return bytes[offset]
+        }
+
+
+        mutating func readUInt64() throws -> UInt64 {
+            guard bytes.count - offset >= 8 else { throw ArchiveError.corruptBlock }
+
+            defer { offset += 8 }
+
+            return UInt64(littleEndian: bytes.loadUnaligned(fromByteOffset: offset, as: UInt64.self))
+        }
+
+
+        mutating func readVarint() throws -> UInt64 {
+            var value: UInt64 = 0
+            var shift: UInt64 = 0
+
+            while true {
+                let byte = try readUInt8()
+
+                guard shift < 64 else { throw ArchiveError.corruptBlock }
+
+                value |= UInt64(byte & 0x7f) << shift
+
+                if byte < 0x80 { return value }
+
+                shift += 7
+            }
+        }
+
+
+        mutating func readString() throws -> String {
+            let length = Int(clamping: try readVarint())
+
+            guard bytes.count - offset >= length else { throw ArchiveError.corruptBlock }
+
+            defer { offset += length }
+
+            return String(decoding: UnsafeRawBufferPointer(rebasing: bytes[offset ..< offset + length]), as: UTF8.self)
+        }
+    }
+}
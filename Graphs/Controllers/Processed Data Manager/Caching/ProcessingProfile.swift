@@ -0,0 +1,59 @@
+//
+//  ProcessingProfile.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// A compact record of the last time a Data Item was processed.
+///
+/// Profiles are kept by the ProcessingProfileStore next to the cached data so that expensive files (e.g. a misconfigured separator that produces one giant column) can be found by sorting the Data Items table.  Times come from PipelineTrace and are 0 while tracing is disabled.
+struct ProcessingProfile: Codable, Sendable, Equatable {
+
+    var date: Date = .now
+
+    /// Size of the decoded file content in UTF-8 bytes.
+    var fileBytes: Int = 0
+
+    var numberOfLines: Int = 0
+
+    var numberOfRows: Int = 0
+
+    var numberOfColumns: Int = 0
+
+    var parseSeconds: Double = 0
+
+    var graphSeconds: Double = 0
+
+    /// True if the last request for the processed data was answered without reparsing.
+    var cacheHit: Bool = false
+
+    /// Estimated bytes held while parsing: the content, the array of lines it was split into, the numbered content and the parsed cells.
+    var peakBytesHeld: Int = 0
+
+
+    /// Records the sizes of `parsedFile` and how long it took to parse.
+    mutating func update(with parsedFile: ParsedFile, parseSeconds: Double) {
+        let contentBytes = parsedFile.content.utf8.count
+
+        fileBytes = contentBytes
+        numberOfLines = parsedFile.content.isEmpty ? 0 : parsedFile.content.utf8.reduce(1) { $1 == 0x0A ? $0 + 1 : $0 }
+        numberOfRows = parsedFile.data.first?.data.count ?? 0
+        numberOfColumns = parsedFile.data.count
+
+        let cellBytes = parsedFile.data.reduce(0) { columnTotal, nextColumn in
+            columnTotal + nextColumn.data.reduce(0) { $0 + $1.utf8.count }
+        }
+
+        // Lines are copies of the content
+        peakBytesHeld = 2 * contentBytes + parsedFile.combinedLineNumbersAndContent.utf8.count + cellBytes
+
+        self.parseSeconds = parseSeconds
+        cacheHit = false
+        date = .now
+    }
+}
@@ -0,0 +1,111 @@
+//
+//  ProcessingProfileStore.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+import OSLog
+
+
+/// Keeps the latest ProcessingProfile of every Data Item and stores them with the cache.
+///
+/// Profiles are read from `URL.processingProfilesURL` on first use and written back shortly after they change, so a burst of processing results in a single write.
+@Observable
+@MainActor
+final class ProcessingProfileStore {
+    static let shared = ProcessingProfileStore()
+
+    private(set) var profiles: [DataItem.LocalID : ProcessingProfile] = [:]
+
+    /// Profile changes are written once no further changes arrive within this delay.
+    static let saveDelay: Duration = .seconds(2)
+
+    @ObservationIgnored
+    private var pendingSave: Task<Void, Never>?
+
+
+    private init() {
+        self.profiles = ProcessingProfileStore.loadProfiles()
+    }
+
+
+    // MARK: - Accessing Profiles
+    func profile(for dataItemID: DataItem.LocalID) -> ProcessingProfile? {
+        profiles[dataItemID]
+    }
+
+
+    /// Updates the profile of a Data Item, creating it if necessary.
+    func update(_ dataItemID: DataItem.LocalID, _ body: (inout ProcessingProfile) -> Void) {
+        var profile = profiles[dataItemID] ?? ProcessingProfile()
+
+        body(&profile)
+
+        if profiles[dataItemID] == profile { return }
+
+        profiles[dataItemID] = profile
+        scheduleSave()
+    }
+
+
+    func removeProfiles(for dataItemIDs: [DataItem.LocalID]) {
+        for nextID in dataItemIDs {
+            profiles.removeValue(forKey: nextID)
+        }
+
+        scheduleSave()
+    }
+
+
+    func removeAllProfiles() {
+        profiles.removeAll()
+        scheduleSave()
+    }
+
+
+
+    // MARK: - Storage
+    private func scheduleSave() {
+        pendingSave?.cancel()
+
+        pendingSave = Task {
+            try? await Task.sleep(for: ProcessingProfileStore.saveDelay)
+
+            if Task.isCancelled { return }
+
+            self.save()
+        }
+    }
+
+
+    private func save() {
+        let url = URL.processingProfilesURL
+
+        do {
+            try FileManager.default.createDirectory(at: url.deletingLastPathComponent(), withIntermediateDirectories: true)
+
+            let data = try JSONEncoder().encode(profiles)
+            try data.write(to: url, options: .atomic)
+        } catch {
+            Logger.processingData.error("Could not save processing profiles to: \(url.path())")
+            Logger.processingData.error("\(error.localizedDescription)")
+        }
+    }
+
+
+    private static func loadProfiles() -> [DataItem.LocalID : ProcessingProfile] {
+        let url = URL.processingProfilesURL
+
+        guard let data = try? Data(contentsOf: url) else { return [:] }
+
+        guard let profiles = try? JSONDecoder().decode([DataItem.LocalID : ProcessingProfile].self, from: data) else {
+            Logger.processingData.info("Discarding unreadable processing profiles at: \(url.path())")
+            return [:]
+        }
+
+        return profiles
+    }
+}
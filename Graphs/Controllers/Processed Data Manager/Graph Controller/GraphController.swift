@@ -16,9 +16,13 @@ class GraphController {
         
     var dgController: DGController?
     
+    /// Data Item whose data is graphed.  Used to attribute pipeline timing.
+    private let dataItemID: DataItem.LocalID?
+    
     // MARK: - Setup
-    init(dgController: DGController?, data: [DataColumn]?) {
+    init(dgController: DGController?, data: [DataColumn]?, dataItemID: DataItem.LocalID? = nil) {
         self.dgController = dgController
+        self.dataItemID = dataItemID
         
         if let dgController {
             self.setDGController(withController: dgController, andData: data)
@@ -57,6 +61,9 @@ class GraphController {
         
         if data.isEmpty { return }
         
+        let interval = PipelineTrace.begin(.updateGraph, dataItemID: dataItemID)
+        defer { interval.end(rows: data.first?.data.count ?? 0) }
+        
         for (index, columnOfData) in data.enumerated() {
             
             let numberOfGraphTemplateColumns = controller.dataColumns().count
@@ -113,3 +120,36 @@ class GraphController {
     }
 }
 
+
+
+// MARK: - Graph Template Columns
+extension GraphController {
+    
+    /// Number of DataGraph columns in each Graph Template, keyed by the template's URL.
+    ///
+    /// The modification date is stored so that edited templates are reloaded.
+    private static var templateColumnCounts: [URL : (dateLastModified: Date?, count: Int)] = [:]
+    
+    
+    /// Returns the number of DataGraph columns in the Graph Template at `url`.
+    ///
+    /// Opening a template is expensive, so counts are cached until the template file changes.
+    static func numberOfTemplateColumns(forTemplateAt url: URL) -> Int? {
+        let dateLastModified = url.dateLastModified
+        
+        if let cachedCount = templateColumnCounts[url], cachedCount.dateLastModified == dateLastModified {
+            return cachedCount.count
+        }
+        
+        guard let controller = DGController(contentsOfFile: url.path(percentEncoded: false)) else {
+            return nil
+        }
+        
+        let count = controller.dataColumns().count
+        
+        templateColumnCounts[url] = (dateLastModified, count)
+        
+        return count
+    }
+}
+
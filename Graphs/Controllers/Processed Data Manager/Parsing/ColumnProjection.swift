@@ -0,0 +1,70 @@
+//
+//  ColumnProjection.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// The set of data columns the Parser should materialize.
+///
+/// Graph Templates only consume as many columns as they have data column slots.  Files with many columns (e.g. spectrometer exports) can be parsed with a projection so that the remaining fields are skipped during tokenization instead of being copied into a `DataColumn`.
+enum ColumnProjection: Sendable, Equatable {
+
+    /// Every column in the file is materialized.
+    case allColumns
+
+    /// Only the columns at the given zero-based indices are materialized.
+    case columns(IndexSet)
+
+
+    /// Creates a projection for the columns consumed by a Graph Template.
+    ///
+    /// The first DataGraph column is reserved by the template, so a template with `numberOfGraphTemplateColumns` columns consumes `numberOfGraphTemplateColumns - 1` parsed columns.  See `GraphController.update(controller:withData:)`.
+    init(numberOfGraphTemplateColumns: Int) {
+        let numberOfConsumedColumns = max(numberOfGraphTemplateColumns - 1, 0)
+
+        self = .columns(IndexSet(integersIn: 0..<numberOfConsumedColumns))
+    }
+
+
+    /// The projected column indices or nil if every column is materialized.
+    var columnIndices: IndexSet? {
+        switch self {
+        case .allColumns: return nil
+        case .columns(let indexSet): return indexSet
+        }
+    }
+
+
+    /// True if every column in the file is materialized.
+    var includesAllColumns: Bool {
+        return columnIndices == nil
+    }
+
+
+    /// Returns true if the column at `index` is materialized by this projection.
+    func contains(_ index: Int) -> Bool {
+        guard let columnIndices else { return true }
+
+        return columnIndices.contains(index)
+    }
+}
+
+
+
+/// A tokenized data row where only the projected fields were copied out of the line.
+struct ProjectedRow {
+
+    /// Total number of fields in the line, including the fields that were skipped.
+    let numberOfFields: Int
+
+    /// Values of the projected fields in ascending column order.
+    let values: [String]
+
+    /// True if every field in the line, projected or not, is empty.
+    let allFieldsAreEmpty: Bool
+}
@@ -20,15 +20,3 @@ enum ParseLineType {
     
     
 }
-
-import SwiftUI
-extension ParseLineType {
-    var color: Color {
-        switch self {
-        case .data: Color.blue
-        case .experimentalDetails: Color.green
-        case .header: Color.cyan
-        default: Color.black
-        }
-    }
-}
@@ -0,0 +1,21 @@
+//
+//  ParseLineType_Color.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import SwiftUI
+
+
+extension ParseLineType {
+    var color: Color {
+        switch self {
+        case .data: Color.blue
+        case .experimentalDetails: Color.green
+        case .header: Color.cyan
+        default: Color.black
+        }
+    }
+}
@@ -0,0 +1,127 @@
+//
+//  ParsePreview.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// The result of parsing a bounded sample of a file.
+///
+/// Previews are used by the Parser editor so that changes to a ParserSettings can be checked against very large files without decoding or parsing the entire file.  See `Parser.preview(_:using:into:options:)`.
+struct ParsePreview: Sendable {
+
+    /// Lines read from the file in the order they appear in the file.
+    var lines: [Line] = []
+
+    /// The sampled lines parsed with the same parse plan as a full parse.
+    var parsedFile: ParsedFile
+
+    /// Size of the file in bytes.
+    var fileSize: UInt64 = 0
+
+    /// True if the entire file fit in the preview.
+    var isComplete: Bool = false
+
+    /// The error thrown by the parse plan, if any.  Lines are still previewed when the parse plan fails.
+    var parserError: ParserError? = nil
+
+
+    /// A single line of the preview.
+    struct Line: Sendable, Identifiable {
+        var id: Int { position }
+
+        /// Position of the line in the preview.
+        let position: Int
+
+        /// The one-based line number or nil for lines sampled from the middle or end of the file, where the line number is unknown.
+        let lineNumber: Int?
+
+        let content: String
+
+        let lineType: ParseLineType
+
+        let section: Section
+    }
+
+
+    /// Part of the file a line was read from.
+    enum Section: Sendable {
+        case beginning
+        case middle
+        case end
+    }
+
+
+    /// Limits for the amount of the file that is read.
+    struct Options: Sendable {
+        /// Maximum number of bytes read from the beginning of the file.
+        var maximumNumberOfBytes: Int = 64 * 1024
+
+        /// Maximum number of lines read from the beginning of the file.
+        var maximumNumberOfLines: Int = 200
+
+        /// Number of lines sampled from the middle of the file.  Set to 0 to skip the middle sample.
+        var numberOfMiddleLines: Int = 10
+
+        /// Number of lines sampled from the end of the file.  Set to 0 to skip the end sample.
+        var numberOfEndLines: Int = 10
+
+        /// Number of bytes read at each sample location.
+        var sampleSize: Int = 8 * 1024
+
+        static let `default` = Options()
+    }
+}
+
+
+// MARK: - Text
+extension ParsePreview {
+
+    /// The preview lines joined by new lines with a marker between each section.
+    var content: String {
+        return joinedLines(withLineNumbers: false)
+    }
+
+
+    /// The preview lines prefixed with their line numbers.
+    var combinedLineNumbersAndContent: String {
+        return joinedLines(withLineNumbers: true)
+    }
+
+
+    /// Marker placed between non-contiguous parts of the preview.
+    static let sectionMarker = "⋮"
+
+
+    private func joinedLines(withLineNumbers: Bool) -> String {
+        let size = (lines.last(where: { $0.lineNumber != nil })?.lineNumber ?? 0).size
+
+        let formatter = NumberFormatter()
+        formatter.minimumIntegerDigits = size
+
+        var output: [String] = []
+        output.reserveCapacity(lines.count + 2)
+
+        var previousSection: Section = .beginning
+
+        for nextLine in lines {
+            if nextLine.section != previousSection {
+                output.append(ParsePreview.sectionMarker)
+                previousSection = nextLine.section
+            }
+
+            if withLineNumbers {
+                let numberString = nextLine.lineNumber.flatMap { formatter.string(from: $0 as NSNumber) } ?? ParsePreview.sectionMarker
+                output.append(numberString + "\t" + nextLine.content)
+            } else {
+                output.append(nextLine.content)
+            }
+        }
+
+        return output.joined(separator: "\n")
+    }
+}
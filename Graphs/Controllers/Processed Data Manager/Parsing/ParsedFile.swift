@@ -7,7 +7,6 @@
 //
 
 import Foundation
-import TabularData
 
 /// The parsed contents of a file.
 struct ParsedFile: Sendable, Codable {
@@ -45,6 +44,20 @@ struct ParsedFile: Sendable, Codable {
     var data: [DataColumn] = []
     
     
+    /// Indices of the columns in `data` that contain parsed values, or nil if every column was parsed.
+    ///
+    /// Columns outside of a ColumnProjection keep their header but have no data.  Use `ProcessedData.loadAllColumns()` to fill them in.
+    private(set) var loadedColumnIndices: IndexSet? = nil
+    
+    
+    /// True if the file was parsed with a ColumnProjection that skipped at least one column.
+    var isProjected: Bool {
+        guard let loadedColumnIndices else { return false }
+        
+        return loadedColumnIndices.count < data.count
+    }
+    
+    
     
     /// A string made from the lines spanning the input file's footer, or an empty string if the Data does not include a Footer.
     ///
@@ -66,6 +79,27 @@ struct ParsedFile: Sendable, Codable {
     }
     
     
+    /// Appends a row that was tokenized with a ColumnProjection.
+    ///
+    /// The row compatibility rules are the same as `appendRow(_:)` and use the total number of fields in the line, so a projected parse keeps exactly the same rows as a full parse.
+    mutating func appendRow(_ row: ProjectedRow, projection columnIndices: IndexSet) {
+        
+        let rowCompatibility = RowCompatibility(rowCount: row.numberOfFields, dataCount: data.count)
+        
+        switch rowCompatibility {
+        case .dataIsEmpty:
+            createInitialDataColumns(withProjectedRow: row, projection: columnIndices, andHeaders: collapsedHeaders)
+        case .equalCount:
+            appendEqualProjectedRow(row)
+        case .lessColumnsThanData, .moreColumnsThanData:
+            // Same behavior as appendRow(_:withHeaders:)
+            return
+        }
+        
+        lastParsedDate = .now
+    }
+    
+    
     private mutating func updateCollapseHeaders() {
         
         let largestColumn = header.max(by: {$0.count > $1.count})
@@ -190,6 +224,35 @@ struct ParsedFile: Sendable, Codable {
     }
     
     
+    private mutating func createInitialDataColumns(withProjectedRow row: ProjectedRow, projection columnIndices: IndexSet, andHeaders headers: [String]) {
+        
+        let loadedIndices = columnIndices.filteredIndexSet(includeInteger: { $0 < row.numberOfFields })
+        
+        var projectedValues = row.values.makeIterator()
+        
+        for index in 0..<row.numberOfFields {
+            let header = index < headers.count ? headers[index] : ""
+            
+            if loadedIndices.contains(index), let nextData = projectedValues.next() {
+                data.append(DataColumn(header: header, data: [nextData]))
+            } else {
+                data.append(DataColumn(header: header, data: []))
+            }
+        }
+        
+        loadedColumnIndices = loadedIndices
+    }
+    
+    
+    private mutating func appendEqualProjectedRow(_ row: ProjectedRow) {
+        guard let loadedColumnIndices else { return }
+        
+        for (index, nextNewData) in zip(loadedColumnIndices, row.values) {
+            data[index].append(nextNewData)
+        }
+    }
+    
+    
     private mutating func appendEqualRow(_ row: [String]) {
         
         for (index, nextNewData) in row.enumerated() {
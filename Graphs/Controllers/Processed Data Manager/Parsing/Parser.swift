@@ -11,11 +11,18 @@ import Foundation
 struct Parser {
     
     
-    static func parse(_ url: URL, using staticSettings: ParserSettingsStatic, into localID: DataItem.LocalID) async throws -> ParsedFile {
+    /// Parses the file at `url` into a ParsedFile.
+    ///
+    /// - Parameter projection: The data columns to materialize.  Fields outside of the projection are counted but never copied out of the line.  Defaults to all columns.
+    static func parse(_ url: URL, using staticSettings: ParserSettingsStatic, into localID: DataItem.LocalID, projection: ColumnProjection = .allColumns) async throws -> ParsedFile {
         
         _ = staticSettings.validateLineStartEndSettings
         
-        var localContent = try content(for: url, using: staticSettings)
+        let parseInterval = PipelineTrace.begin(.parse, dataItemID: localID)
+        
+        var localContent = try content(for: url, using: staticSettings, dataItemID: localID)
+        
+        let splitLinesInterval = PipelineTrace.begin(.splitLines, dataItemID: localID)
         
         if staticSettings.newLineType == .auto {
             localContent = localContent.replacingOccurrences(of: "\r", with: "")
@@ -25,6 +32,8 @@ struct Parser {
         
         let lines: [String] = localContent.components(separatedBy: lineSeparator)
         
+        splitLinesInterval.end(rows: lines.count)
+        
         var parsedFile = ParsedFile(dataItemID: localID)
         
         parsedFile.content = localContent
@@ -34,50 +43,13 @@ struct Parser {
         
         let numberOfLines = lines.count
         
+        // Per line stages are accumulated and recorded once
+        var stageTimes = StageTimes()
+        
         for  nextLine in lines {
-            let type = staticSettings.parseLineType(for: index)
+            try parse(line: nextLine, at: index, using: staticSettings, projection: projection, into: &parsedFile, stageTimes: &stageTimes)
             
-            switch type {
-            case .skip: break
-            case .error: break
-                //print("Error during parsing at index: \(index).  For line:\n\(nextLine)")
-            case .experimentalDetails:
-                if index == staticSettings.experimentalDetailsStart {
-                    parsedFile.experimentDetails.append(nextLine)
-                } else {
-                    parsedFile.experimentDetails.append("\n")
-                    parsedFile.experimentDetails.append(nextLine)
-                }
-            case .header:
-                let separator = staticSettings.headerSeparator
-                
-                if separator == .none { throw ParserError.noHeaderSeparator }
-                
-                let nextheaderLine = parse(line: nextLine, withSeparator: separator)
-                
-                parsedFile.header.append(nextheaderLine)
-                
-            case .data:
-                
-                if staticSettings.stopDataAtFirstEmptyLine && nextLine.isEmpty {
-                    break
-                }
-                
-                let separator = staticSettings.dataSeparator
-                if separator == .none { throw ParserError.noDataSeparator }
-                let nextDataLine = parse(line: nextLine, withSeparator: separator)
-                
-                if staticSettings.stopDataAtFirstEmptyLine {
-                    if nextDataLine.allAreEmpty() {
-                        break
-                    }
-                }
-                
-                parsedFile.appendRow(nextDataLine)
-               
-            case .end:
-                break
-            }
+            let lineNumbersStart = PipelineTrace.now()
             
             // Add simpleNumberedString to the parsed file
             let numberedString = simpleLineNumber(for: nextLine, at: index, totalNumberOfLines: numberOfLines)
@@ -88,15 +60,151 @@ struct Parser {
                 parsedFile.combinedLineNumbersAndContent.append(numberedString)
             }
             
+            stageTimes.lineNumbers += PipelineTrace.now() - lineNumbersStart
+            
             index += 1
         }
         
+        let numberOfRows = parsedFile.data.first?.data.count ?? 0
+        let numberOfBytes = localContent.utf8.count
+        
+        PipelineTrace.record(.tokenize, nanoseconds: stageTimes.tokenize, dataItemID: localID, bytes: numberOfBytes, rows: numberOfRows)
+        PipelineTrace.record(.appendRow, nanoseconds: stageTimes.appendRow, dataItemID: localID, rows: numberOfRows)
+        PipelineTrace.record(.lineNumbers, nanoseconds: stageTimes.lineNumbers, dataItemID: localID, rows: numberOfLines)
+        
+        parseInterval.end(bytes: numberOfBytes, rows: numberOfRows)
       
         return parsedFile
         
     }
 
     
+    /// Time accumulated by the stages that run once per line.
+    struct StageTimes {
+        var tokenize: UInt64 = 0
+        var appendRow: UInt64 = 0
+        var lineNumbers: UInt64 = 0
+    }
+    
+    
+    /// Applies the parse plan to a single line.
+    ///
+    /// - Parameter index: The one-based line number used to determine the ParseLineType of the line.
+    static func parse(line nextLine: String, at index: Int, using staticSettings: ParserSettingsStatic, projection: ColumnProjection, into parsedFile: inout ParsedFile) throws {
+        var stageTimes = StageTimes()
+        
+        try parse(line: nextLine, at: index, using: staticSettings, projection: projection, into: &parsedFile, stageTimes: &stageTimes)
+    }
+    
+    
+    private static func parse(line nextLine: String, at index: Int, using staticSettings: ParserSettingsStatic, projection: ColumnProjection, into parsedFile: inout ParsedFile, stageTimes: inout StageTimes) throws {
+        
+        let type = staticSettings.parseLineType(for: index)
+        
+        switch type {
+        case .skip: break
+        case .error: break
+            //print("Error during parsing at index: \(index).  For line:\n\(nextLine)")
+        case .experimentalDetails:
+            if index == staticSettings.experimentalDetailsStart {
+                parsedFile.experimentDetails.append(nextLine)
+            } else {
+                parsedFile.experimentDetails.append("\n")
+                parsedFile.experimentDetails.append(nextLine)
+            }
+        case .header:
+            let separator = staticSettings.headerSeparator
+            
+            if separator == .none { throw ParserError.noHeaderSeparator }
+            
+            let nextheaderLine = parse(line: nextLine, withSeparator: separator)
+            
+            parsedFile.header.append(nextheaderLine)
+            
+        case .data:
+            
+            if staticSettings.stopDataAtFirstEmptyLine && nextLine.isEmpty {
+                break
+            }
+            
+            let separator = staticSettings.dataSeparator
+            if separator == .none { throw ParserError.noDataSeparator }
+            
+            let tokenizeStart = PipelineTrace.now()
+            
+            if let columnIndices = projection.columnIndices {
+                let nextProjectedRow = parse(line: nextLine, withSeparator: separator, keeping: columnIndices)
+                
+                let appendRowStart = PipelineTrace.now()
+                stageTimes.tokenize += appendRowStart - tokenizeStart
+                
+                if staticSettings.stopDataAtFirstEmptyLine {
+                    if nextProjectedRow.allFieldsAreEmpty {
+                        break
+                    }
+                }
+                
+                parsedFile.appendRow(nextProjectedRow, projection: columnIndices)
+                
+                stageTimes.appendRow += PipelineTrace.now() - appendRowStart
+                break
+            }
+            
+            let nextDataLine = parse(line: nextLine, withSeparator: separator)
+            
+            let appendRowStart = PipelineTrace.now()
+            stageTimes.tokenize += appendRowStart - tokenizeStart
+            
+            if staticSettings.stopDataAtFirstEmptyLine {
+                if nextDataLine.allAreEmpty() {
+                    break
+                }
+            }
+            
+            parsedFile.appendRow(nextDataLine)
+            
+            stageTimes.appendRow += PipelineTrace.now() - appendRowStart
+           
+        case .end:
+            break
+        }
+    }
+    
+    
+    /// Reads and decodes the file while recording the readFile and decode pipeline stages.
+    ///
+    /// Automatic encoding detection reads and decodes the file in a single step, so it is only recorded as decode.
+    static func content(for url: URL, using staticSettings: ParserSettingsStatic, dataItemID: DataItem.LocalID?) throws -> String {
+        
+        if staticSettings.stringEncodingType == .automatic {
+            let decodeInterval = PipelineTrace.begin(.decode, dataItemID: dataItemID)
+            
+            let localContent = try content(for: url, using: staticSettings)
+            
+            decodeInterval.end(bytes: localContent.utf8.count)
+            
+            return localContent
+        }
+        
+        let readInterval = PipelineTrace.begin(.readFile, dataItemID: dataItemID)
+        
+        guard let data = try? Data(contentsOf: url) else {
+            throw ParserError.couldNotGetStringFromURL
+        }
+        
+        readInterval.end(bytes: data.count)
+        
+        let decodeInterval = PipelineTrace.begin(.decode, dataItemID: dataItemID)
+        
+        guard let localContent = String(data: data, encoding: staticSettings.stringEncodingType.encoding) else {
+            throw ParserError.couldNotGetStringFromURL
+        }
+        
+        decodeInterval.end(bytes: data.count)
+        
+        return localContent
+    }
+    
     
     static func content(for url: URL, using staticSettings: ParserSettingsStatic) throws -> String {
         let encoding = staticSettings.stringEncodingType.encoding
@@ -169,6 +277,53 @@ struct Parser {
     }
     
     
+    /// Splits a line by the separator but only copies the fields whose index is in `columnIndices`.
+    ///
+    /// Skipped fields are scanned to keep the field count (and therefore the row compatibility checks in ParsedFile) identical to `parse(line:withSeparator:)`, but no String is created for them.
+    private static func parse(line: String, withSeparator separator: Separator, keeping columnIndices: IndexSet) -> ProjectedRow {
+        
+        guard let separatorCharacterSet = separator.characterSet else {
+            let values = columnIndices.contains(0) ? [line] : []
+            return ProjectedRow(numberOfFields: 1, values: values, allFieldsAreEmpty: line.isEmpty)
+        }
+        
+        let scalars = line.unicodeScalars
+        
+        var values: [String] = []
+        values.reserveCapacity(columnIndices.count)
+        
+        var fieldIndex = 0
+        var fieldStart = scalars.startIndex
+        var allFieldsAreEmpty = true
+        
+        var index = scalars.startIndex
+        
+        while index != scalars.endIndex {
+            if separatorCharacterSet.contains(scalars[index]) {
+                if fieldStart != index { allFieldsAreEmpty = false }
+                
+                if columnIndices.contains(fieldIndex) {
+                    values.append(String(Substring(scalars[fieldStart..<index])))
+                }
+                
+                fieldIndex += 1
+                fieldStart = scalars.index(after: index)
+            }
+            
+            index = scalars.index(after: index)
+        }
+        
+        // The last field is not followed by a separator
+        if fieldStart != scalars.endIndex { allFieldsAreEmpty = false }
+        
+        if columnIndices.contains(fieldIndex) {
+            values.append(String(Substring(scalars[fieldStart..<scalars.endIndex])))
+        }
+        
+        return ProjectedRow(numberOfFields: fieldIndex + 1, values: values, allFieldsAreEmpty: allFieldsAreEmpty)
+    }
+    
+    
     
     
     private static func indexInRange(_ index: Int, startRange: Int, endRange: Int) throws -> Bool{
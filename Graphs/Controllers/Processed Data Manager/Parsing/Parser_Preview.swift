@@ -0,0 +1,264 @@
+//
+//  Parser_Preview.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+// MARK: - Preview
+extension Parser {
+
+    /// Parses a bounded sample of the file at `url`.
+    ///
+    /// Only the first `options.maximumNumberOfBytes` (up to `options.maximumNumberOfLines` lines) are decoded, plus optional samples from the middle and end of the file that are read by seeking.  The sampled lines are run through the same parse plan as `parse(_:using:into:projection:)`.
+    ///
+    /// Lines sampled from the middle and end of the file do not have a known line number.  They are parsed as if they immediately followed the beginning of the file, which is correct for files whose data section starts within the preview.
+    static func preview(_ url: URL, using staticSettings: ParserSettingsStatic, into localID: DataItem.LocalID, options: ParsePreview.Options = .default) throws -> ParsePreview {
+
+        let fileHandle = try FileHandle(forReadingFrom: url)
+        defer { try? fileHandle.close() }
+
+        let fileSize = try fileHandle.seekToEnd()
+        try fileHandle.seek(toOffset: 0)
+
+        var preview = ParsePreview(parsedFile: ParsedFile(dataItemID: localID))
+        preview.fileSize = fileSize
+
+
+        // Beginning of the file
+        let beginningData = try fileHandle.read(upToCount: options.maximumNumberOfBytes) ?? Data()
+        let fileIsTruncated = UInt64(beginningData.count) < fileSize
+
+        let (encoding, byteOrderMarkLength) = previewEncoding(for: staticSettings, beginning: beginningData)
+
+        var beginningLines = try previewLines(from: beginningData.dropFirst(byteOrderMarkLength), encoding: encoding, using: staticSettings, dropFirstLine: false, dropLastLine: fileIsTruncated)
+
+        var allLinesRead = !fileIsTruncated
+
+        if beginningLines.count > options.maximumNumberOfLines {
+            beginningLines = Array(beginningLines[0..<options.maximumNumberOfLines])
+            allLinesRead = false
+        }
+
+        for (offset, nextLine) in beginningLines.enumerated() {
+            preview.appendLine(nextLine, lineNumber: offset + 1, section: .beginning, using: staticSettings)
+        }
+
+        preview.isComplete = allLinesRead
+
+        if allLinesRead || !canSeek(in: encoding) {
+            preview.updateContent()
+            return preview
+        }
+
+
+        // Middle and end of the file
+        let sampledLineNumber = beginningLines.count + 1
+        let endOfBeginning = UInt64(beginningData.count)
+        let sampleSize = UInt64(options.sampleSize)
+
+        let middleOffset = fileSize / 2
+
+        if options.numberOfMiddleLines > 0 && middleOffset > endOfBeginning && middleOffset + sampleSize < fileSize {
+            try fileHandle.seek(toOffset: middleOffset)
+
+            let middleData = try fileHandle.read(upToCount: options.sampleSize) ?? Data()
+
+            let middleLines = (try? previewLines(from: middleData, encoding: encoding, using: staticSettings, dropFirstLine: true, dropLastLine: true)) ?? []
+
+            for nextLine in middleLines.prefix(options.numberOfMiddleLines) {
+                preview.appendLine(nextLine, lineNumber: nil, sampledAt: sampledLineNumber, section: .middle, using: staticSettings)
+            }
+        }
+
+        let endOffset = fileSize > sampleSize ? fileSize - sampleSize : 0
+
+        if options.numberOfEndLines > 0 && endOffset > endOfBeginning {
+            try fileHandle.seek(toOffset: endOffset)
+
+            let endData = try fileHandle.readToEnd() ?? Data()
+
+            let endLines = (try? previewLines(from: endData, encoding: encoding, using: staticSettings, dropFirstLine: true, dropLastLine: false)) ?? []
+
+            for nextLine in endLines.suffix(options.numberOfEndLines) {
+                preview.appendLine(nextLine, lineNumber: nil, sampledAt: sampledLineNumber, section: .end, using: staticSettings)
+            }
+        }
+
+        preview.updateContent()
+
+        return preview
+    }
+
+
+    /// Decodes `data` and splits it into lines.
+    ///
+    /// - Parameters:
+    ///   - encoding: The encoding from `previewEncoding(for:beginning:)`.
+    ///   - dropFirstLine: Drop everything up to and including the first new line.  Used when `data` starts at an arbitrary offset in the file, which is only done for encodings where `canSeek(in:)` is true.
+    ///   - dropLastLine: Drop everything after the last new line.  Used when `data` ends at an arbitrary offset in the file.  If `data` has no new line, the partial line is kept.
+    private static func previewLines(from data: Data, encoding: String.Encoding?, using staticSettings: ParserSettingsStatic, dropFirstLine: Bool, dropLastLine: Bool) throws -> [String] {
+
+        var localData = data
+
+        let newLineByte: UInt8 = staticSettings.newLineType == .CR ? 0x0D : 0x0A
+
+        if dropFirstLine {
+            guard let firstNewLine = localData.firstIndex(of: newLineByte) else { return [] }
+            localData = localData[localData.index(after: firstNewLine)...]
+        }
+
+        // Searching the bytes would split the code units of multi byte encodings, so their last line is dropped after decoding
+        var dropsLastLineAfterDecoding = false
+
+        if dropLastLine {
+            if canSeek(in: encoding), let lastNewLine = localData.lastIndex(of: newLineByte) {
+                localData = localData[...lastNewLine]
+            } else {
+                dropsLastLineAfterDecoding = true
+            }
+        }
+
+        let decodedContent = dropsLastLineAfterDecoding ? content(fromPrefixOf: localData, encoding: encoding) : content(from: localData, encoding: encoding)
+
+        guard var localContent = decodedContent else {
+            throw ParserError.couldNotGetStringFromURL
+        }
+
+        if staticSettings.newLineType == .auto {
+            localContent = localContent.replacingOccurrences(of: "\r", with: "")
+        }
+
+        var lines = localContent.components(separatedBy: staticSettings.newLineType.stringLiteral)
+        
+        if dropsLastLineAfterDecoding {
+            // A first line longer than the data is kept as a partial line
+            if lines.count > 1 {
+                lines.removeLast()
+            }
+        } else if dropLastLine && lines.last?.isEmpty == true {
+            // The data ends with a new line so the last component is empty
+            lines.removeLast()
+        }
+        
+        return lines
+    }
+
+
+    /// The encoding used to decode the preview, and the length of the byte order mark to skip at the start of the file.
+    ///
+    /// In automatic mode the full parse (`content(for:using:)`) honours UTF-8, UTF-16 and UTF-32 byte order marks, so the preview uses the encoding of the mark too.  Nil for automatic mode without a byte order mark, which is decoded as UTF-8 or Windows-1250.
+    private static func previewEncoding(for staticSettings: ParserSettingsStatic, beginning data: Data) -> (encoding: String.Encoding?, byteOrderMarkLength: Int) {
+        guard staticSettings.stringEncodingType == .automatic else {
+            return (staticSettings.stringEncodingType.encoding, 0)
+        }
+
+        let bytes = Array(data.prefix(4))
+
+        // UTF-32 little endian starts like UTF-16 little endian, so it is checked first
+        if bytes.starts(with: [0xFF, 0xFE, 0x00, 0x00]) { return (.utf32LittleEndian, 4) }
+        if bytes.starts(with: [0x00, 0x00, 0xFE, 0xFF]) { return (.utf32BigEndian, 4) }
+        if bytes.starts(with: [0xEF, 0xBB, 0xBF]) { return (.utf8, 3) }
+        if bytes.starts(with: [0xFF, 0xFE]) { return (.utf16LittleEndian, 2) }
+        if bytes.starts(with: [0xFE, 0xFF]) { return (.utf16BigEndian, 2) }
+
+        return (nil, 0)
+    }
+
+
+    /// Decodes `data` using the same encoding rules as `content(for:using:)`.
+    private static func content(from data: Data, encoding: String.Encoding?) -> String? {
+        guard let encoding else {
+            return String(data: data, encoding: .utf8) ?? String(data: data, encoding: .windowsCP1250)
+        }
+
+        return String(data: data, encoding: encoding)
+    }
+
+
+    /// Decodes `data`, which may end in the middle of a code unit or of a character, without the incomplete character at the end.
+    private static func content(fromPrefixOf data: Data, encoding: String.Encoding?) -> String? {
+        let codeUnitSize = codeUnitSize(of: encoding)
+
+        var localData = data.prefix(data.count - data.count % codeUnitSize)
+
+        // A character is at most 4 bytes long in every supported encoding
+        for _ in 0 ... 4 / codeUnitSize {
+            if let localContent = content(from: localData, encoding: encoding) {
+                return localContent
+            }
+
+            guard localData.count >= codeUnitSize else { return nil }
+
+            localData = localData.dropLast(codeUnitSize)
+        }
+
+        return nil
+    }
+
+
+    private static func codeUnitSize(of encoding: String.Encoding?) -> Int {
+        switch encoding {
+        case .unicode, .utf16, .utf16BigEndian, .utf16LittleEndian:
+            return 2
+        case .utf32, .utf32BigEndian, .utf32LittleEndian:
+            return 4
+        default:
+            return 1
+        }
+    }
+
+
+    /// True if new lines can be found by searching for a single byte, which is required to read lines starting at an arbitrary offset.
+    private static func canSeek(in encoding: String.Encoding?) -> Bool {
+        switch encoding {
+        case .unicode, .utf16, .utf16BigEndian, .utf16LittleEndian, .utf32, .utf32BigEndian, .utf32LittleEndian:
+            return false
+        default:
+            return true
+        }
+    }
+}
+
+
+
+// MARK: - Building the Preview
+extension ParsePreview {
+
+    /// Appends a line and runs it through the parse plan.
+    ///
+    /// - Parameter sampledLineNumber: The line number used to determine the ParseLineType for lines whose actual line number is unknown.
+    fileprivate mutating func appendLine(_ line: String, lineNumber: Int?, sampledAt sampledLineNumber: Int? = nil, section: Section, using staticSettings: ParserSettingsStatic) {
+
+        let parseIndex = lineNumber ?? sampledLineNumber ?? 1
+
+        let newLine = Line(position: lines.count,
+                           lineNumber: lineNumber,
+                           content: line,
+                           lineType: staticSettings.parseLineType(for: parseIndex),
+                           section: section)
+
+        lines.append(newLine)
+
+        // Keep previewing lines after the parse plan fails so the user can fix the Parser
+        if parserError != nil { return }
+
+        do {
+            try Parser.parse(line: line, at: parseIndex, using: staticSettings, projection: .allColumns, into: &parsedFile)
+        } catch let error as ParserError {
+            parserError = error
+        } catch {
+            parserError = .couldNotGetStringFromURL
+        }
+    }
+
+
+    fileprivate mutating func updateContent() {
+        parsedFile.content = content
+        parsedFile.combinedLineNumbersAndContent = combinedLineNumbersAndContent
+    }
+}
@@ -16,10 +16,30 @@ class ProcessDataManager {
     
     private var processedData: [DataItem.ID : ProcessedData] = [:]
     
+    /// Processed Data that is being made.  A Data Item requested again in the meantime (e.g. by the selection while a session is restored) waits for it instead of being processed twice.
+    private var pendingProcessedData: [DataItem.ID : Task<ProcessedData, Never>] = [:]
+    
+    /// Number of Data Items processed at the same time.
+    static let maximumConcurrency = 4
+    
     var cacheManager: CacheManager
     
     var dataSource: ProcessDataManagerDataSource?
     
+    /// Set to true while a view needs every parsed column (e.g. the Table Inspector).  Otherwise only the columns used by the Graph Template are parsed.
+    var requiresAllParsedColumns: Bool = false
+    
+    /// Parser Settings edits are committed (and the selection fully reparsed) once no further edits arrive within this delay.  The ParseViewer shows a bounded preview in the meantime.
+    static let parserSettingsCommitDelay: Duration = .milliseconds(750)
+    
+    private var pendingParserSettingsCommit: Task<Void, Never>?
+    
+    /// Data Items of every Parser Settings edited since the last commit.
+    private var pendingParserSettingsDataItemIDs: Set<DataItem.ID> = []
+    
+    /// Parses the files that changed while the app was closed.
+    private var backgroundReparse: Task<Void, Never>?
+    
     
     // MARK: - Initialization
     init(cacheManager: CacheManager, dataSource: ProcessDataManagerDataSource?) {
@@ -29,15 +49,32 @@ class ProcessDataManager {
     }
     
     // MARK: - Processed Data
+    /// Processed Data in the order of `dataItems`.  Up to `maximumConcurrency` Data Items are parsed or read from the cache in parallel.
     func processedData(for dataItems: [DataItem]) async -> [ProcessedData] {
-        var output: [ProcessedData] = []
-        
-        for nextDataItem in dataItems {
-            let nextProcessedData = await processedData(for: nextDataItem)
-            output.append(nextProcessedData)
+        if dataItems.count == 1, let dataItem = dataItems.first {
+            return [await processedData(for: dataItem)]
         }
         
-        return output
+        return await withTaskGroup(of: (Int, ProcessedData).self) { group in
+            var output = [ProcessedData?](repeating: nil, count: dataItems.count)
+            var remainingDataItems = dataItems.enumerated().makeIterator()
+            
+            // Start the first Data Items, then one more as each one finishes
+            for _ in 0 ..< ProcessDataManager.maximumConcurrency {
+                guard let (nextIndex, nextDataItem) = remainingDataItems.next() else { break }
+                group.addTask { (nextIndex, await self.processedData(for: nextDataItem)) }
+            }
+            
+            for await (nextIndex, nextProcessedData) in group {
+                output[nextIndex] = nextProcessedData
+                
+                if let (nextIndex, nextDataItem) = remainingDataItems.next() {
+                    group.addTask { (nextIndex, await self.processedData(for: nextDataItem)) }
+                }
+            }
+            
+            return output.compactMap { $0 }
+        }
     }
     
     
@@ -50,6 +87,7 @@ class ProcessDataManager {
              // Check to see if cached data is up to date
              if output.parsedFileState == .upToDate && output.graphTemplateState == .upToDate {
                  // Cached data is up to date, return cached data
+                 ProcessingProfileStore.shared.update(dataItem.localID) { $0.cacheHit = true }
                  return output
              } else {
                  // Cached data isn't up to date, reprocess the data
@@ -63,28 +101,45 @@ class ProcessDataManager {
     
     
     private func generateNewProcessedData(for dataItem: DataItem) async -> ProcessedData {
-        let newProcessedData = await ProcessedData(dataItem: dataItem, delegate: self)
+        if let pendingTask = pendingProcessedData[dataItem.id] {
+            return await pendingTask.value
+        }
         
+        let task = Task { await ProcessedData(dataItem: dataItem, delegate: self) }
+        pendingProcessedData[dataItem.id] = task
+        
+        let newProcessedData = await task.value
+        
+        pendingProcessedData[dataItem.id] = nil
         processedData[dataItem.id] = newProcessedData
         
+        // Keep the Data Item in the reverse lookups of its Parser Settings and Graph Template
+        EffectiveSettingsResolver.shared.track(dataItem)
+        
         return newProcessedData
     }
     
     
     
-    // MARK: - Deleting
+    /// Every Processed Data that has been made, e.g. to record it in the session snapshot.
+    var allLoadedProcessedData: [ProcessedData] {
+        Array(processedData.values)
+    }
+    
     
-    func preparingToDelete(nodes: [Node]) {
-        var dataItems: Set<DataItem> = []
+    /// Processes the Data Items at background priority, so that they are ready when they are selected again.  Used for the Data Items of a restored session that are not selected.
+    func rehydrate(_ dataItems: [DataItem]) {
+        if dataItems.isEmpty { return }
         
-        for nextNode in nodes {
-            dataItems.formUnion(nextNode.flattenedDataItems())
+        Task(priority: .background) {
+            _ = await self.processedData(for: dataItems)
         }
-        
-        self.preparingToDelete(dataItems: Array(dataItems))
     }
     
     
+    
+    // MARK: - Deleting
+    
     func preparingToDelete(dataItems: [DataItem]) {
         for nextDataItem in dataItems {
             delete(dataItem: nextDataItem)
@@ -94,27 +149,136 @@ class ProcessDataManager {
     
     private func delete(dataItem: DataItem) {
         processedData.removeValue(forKey: dataItem.id)
+        EffectiveSettingsResolver.shared.untrack(dataItem.id)
         self.deleteCache(for: dataItem)
+        ProcessingProfileStore.shared.removeProfiles(for: [dataItem.localID])
+        CacheManifest.shared.removeEntries(for: [dataItem.localID])
     }
     
     
     func preparingToDelete(parserSetting: ParserSettings) {
+        let dataItemIDs = EffectiveSettingsResolver.shared.dataItemIDs(usingParserSettings: parserSetting.localID)
         
-        for nextProcessedData in self.processedData {
-            let nextDataItem = nextProcessedData.value.dataItem
-            
-            if nextDataItem.getAssociatedParserSettings()?.id == parserSetting.id {
-                nextProcessedData.value.parsedFileState = .outOfDate
-            }
+        for nextProcessedData in loadedProcessedData(withIDs: dataItemIDs).values {
+            nextProcessedData.parsedFileState = .outOfDate
         }
     }
     
     func preparingToDelete(graphTemplate: GraphTemplate) {
-        for nextProcessedData in self.processedData {
-            let nextDataItem = nextProcessedData.value.dataItem
-            
-            if nextDataItem.getAssociatedGraphTemplate()?.id == graphTemplate.id {
-                nextProcessedData.value.graphTemplateState = .outOfDate
+        let dataItemIDs = EffectiveSettingsResolver.shared.dataItemIDs(usingGraphTemplate: graphTemplate.localID)
+        
+        for nextProcessedData in loadedProcessedData(withIDs: dataItemIDs).values {
+            nextProcessedData.graphTemplateState = .outOfDate
+        }
+    }
+    
+    
+    
+    // MARK: - Changed Files
+    /// Marks the processed data of changed files as out of date and reprocesses the current selection in the background.
+    ///
+    /// The cache on disk is removed for the changed Data Items.  Cached graphs of a changed Graph Template become out of date once the CacheManifest reads the new template version.
+    func filesDidChange(dataItems: [DataItem], graphTemplates: [GraphTemplate]) {
+        cacheManager.clearCache(for: dataItems)
+        CacheManifest.shared.markStale(dataItems.map { $0.localID })
+        
+        for nextGraphTemplate in graphTemplates {
+            CacheManifest.shared.graphTemplateFileDidChange(nextGraphTemplate.localID)
+        }
+        
+        FileMetadataStore.shared.refresh(dataItems.map { $0.url } + graphTemplates.map { $0.url })
+        
+        let changedDataFiles = loadedProcessedData(withIDs: dataItems.map { $0.id })
+        
+        for nextProcessedData in changedDataFiles.values {
+            nextProcessedData.dataFileDidChange()
+        }
+        
+        var graphTemplateDataItemIDs: Set<DataItem.ID> = []
+        
+        for nextGraphTemplate in graphTemplates {
+            graphTemplateDataItemIDs.formUnion(EffectiveSettingsResolver.shared.dataItemIDs(usingGraphTemplate: nextGraphTemplate.localID))
+        }
+        
+        let changedGraphTemplateFiles = loadedProcessedData(withIDs: graphTemplateDataItemIDs)
+        
+        for nextProcessedData in changedGraphTemplateFiles.values {
+            nextProcessedData.graphTemplateFileDidChange()
+        }
+        
+        
+        // Reprocess only the current selection.  The rest are reprocessed when they are next used
+        guard let currentSelection = dataSource?.currentSelection() else { return }
+        
+        let processedDataToReload = currentSelection.compactMap { changedDataFiles[$0] ?? changedGraphTemplateFiles[$0] }
+        
+        if processedDataToReload.isEmpty { return }
+        
+        Task(priority: .utility) {
+            for nextProcessedData in processedDataToReload {
+                await nextProcessedData.reloadChangedFiles()
+            }
+        }
+    }
+    
+    
+    /// Compares every parsed data file against the signature recorded in the CacheManifest, then handles the changed files like `filesDidChange(dataItems:graphTemplates:)` and parses them again in the background.
+    ///
+    /// Run at launch so that files changed while the app was closed (e.g. on a network drive) are known before they are used.
+    func scanForChangedFiles(in dataItems: [DataItem]) async {
+        let manifest = CacheManifest.shared
+        
+        let entries = dataItems.compactMap { nextDataItem in
+            manifest.fileSignature(for: nextDataItem.localID).map {
+                FileChangeScanner.Entry(dataItemID: nextDataItem.localID, url: nextDataItem.url, signature: $0)
+            }
+        }
+        
+        if entries.isEmpty { return }
+        
+        let changedIDs = await FileChangeScanner().changedDataItemIDs(in: entries)
+        
+        Logger.processingData.info("Found \(changedIDs.count) of \(entries.count) data files changed since they were parsed")
+        
+        if changedIDs.isEmpty { return }
+        
+        let changedDataItems = dataItems.filter { changedIDs.contains($0.localID) }
+        
+        filesDidChange(dataItems: changedDataItems, graphTemplates: [])
+        reparseInBackground(changedDataItems.filter { processedData[$0.id] == nil })
+    }
+    
+    
+    /// Parses the Data Items one at a time at background priority and writes the results to the cache.
+    private func reparseInBackground(_ dataItems: [DataItem]) {
+        let jobs = dataItems.compactMap { nextDataItem in
+            EffectiveSettingsResolver.shared.parserSettings(for: nextDataItem).map {
+                (url: nextDataItem.url, dataItemID: nextDataItem.localID, staticSettings: $0.parserSettingsStatic)
+            }
+        }
+        
+        if jobs.isEmpty { return }
+        
+        backgroundReparse?.cancel()
+        
+        let localCacheManager = cacheManager
+        
+        backgroundReparse = Task.detached(priority: .background) {
+            for nextJob in jobs {
+                if Task.isCancelled { return }
+                
+                let signature = FileSignature(contentsOf: nextJob.url)
+                
+                do {
+                    let parsedFile = try await Parser.parse(nextJob.url, using: nextJob.staticSettings, into: nextJob.dataItemID)
+                    
+                    // The parse is recorded first so that the cached file matches the signature
+                    await CacheManifest.shared.recordParse(of: nextJob.dataItemID, signature: signature)
+                    
+                    await localCacheManager.cacheData(parsedFile: parsedFile, for: nextJob.dataItemID, sourceURL: nextJob.url, parserSettings: nextJob.staticSettings)
+                } catch {
+                    Logger.processingData.info("Could not reparse changed file: \(nextJob.url.path(percentEncoded: false))")
+                }
             }
         }
     }
@@ -165,11 +329,23 @@ extension ProcessDataManager {
     }
     
     
+    /// The loaded ProcessedData of the Data Items, looked up by ID rather than by scanning every loaded ProcessedData.
+    private func loadedProcessedData(withIDs ids: some Sequence<DataItem.ID>) -> [DataItem.ID : ProcessedData] {
+        var output: [DataItem.ID : ProcessedData] = [:]
+        
+        for nextID in ids {
+            if let nextProcessedData = processedData[nextID] {
+                output[nextID] = nextProcessedData
+            }
+        }
+        
+        return output
+    }
+    
+    
     // MARK: - Implement Graph Template Changes
     private func graphTemplateChanged(for dataItemIDs: [DataItem.ID]) {
-        let processedDataToUpdate = processedData.filter({id, data in
-            dataItemIDs.contains( where: { $0 == id})
-        })
+        let processedDataToUpdate = loadedProcessedData(withIDs: dataItemIDs)
         
         
         // Update parsedFileState to be out of date so that the data is reparsed and regraphed next time the processed data is used
@@ -179,11 +355,11 @@ extension ProcessDataManager {
         
         
         // Process only current selection to save resources
+        // The rest are reprocessed when they are next used
         if let currentSelection = dataSource?.currentSelection() {
-            let dataItemsToUpdate = processedDataToUpdate.filter( {id, data in
-                currentSelection.contains(id) })
+            let dataItemsToUpdate = currentSelection.compactMap { processedDataToUpdate[$0] }
             
-            for nextProcessedData in dataItemsToUpdate.values {
+            for nextProcessedData in dataItemsToUpdate {
                 Task {
                     do {
                         try await nextProcessedData.loadGraphController()
@@ -203,27 +379,34 @@ extension ProcessDataManager {
         
         guard let parserSettingIDs: [ParserSettings.LocalID] = userInfo[key] as? [ParserSettings.LocalID] else { return }
         
-        guard let parserSettingsID = parserSettingIDs.first else { return }
-        
-        let processedDataToUpdate: [ProcessedData] = processedData.values.filter( { $0.dataItem.getAssociatedParserSettings()?.localID == parserSettingsID})
+        // Only the loaded ProcessedData that use the Parser Settings
+        for nextParserSettingsID in parserSettingIDs {
+            let dataItemIDs = EffectiveSettingsResolver.shared.dataItemIDs(usingParserSettings: nextParserSettingsID)
+            
+            pendingParserSettingsDataItemIDs.formUnion(loadedProcessedData(withIDs: dataItemIDs).keys)
+        }
         
-        let dataItemIDsToUpdate = processedDataToUpdate.map({ $0.dataItem.id})
         
+        // Each edit in the Parser editor posts a change.  Only reparse once the edits are committed.  Edits of other Parser Settings in the meantime are collected into the same commit.
+        pendingParserSettingsCommit?.cancel()
         
-        parserOnDataItemDidChange(forDataItemIDS: dataItemIDsToUpdate)
+        pendingParserSettingsCommit = Task {
+            try? await Task.sleep(for: ProcessDataManager.parserSettingsCommitDelay)
+            
+            if Task.isCancelled { return }
+            
+            let dataItemIDsToUpdate = Array(self.pendingParserSettingsDataItemIDs)
+            self.pendingParserSettingsDataItemIDs.removeAll()
+            
+            self.parserOnDataItemDidChange(forDataItemIDS: dataItemIDsToUpdate)
+        }
     }
     
     
     
     private func parserOnDataItemDidChange(forDataItemIDS ids: [DataItem.ID]) {
         
-        let processedDataToUpdate = processedData.filter( {id, data in
-            if ids.contains(id) {
-                return true
-            } else {
-                return false
-            }
-        } )
+        let processedDataToUpdate = loadedProcessedData(withIDs: ids)
         
         
         // Update parsedFileState to be out of date so that the data is reparsed and regraphed next time the processed data is used
@@ -233,14 +416,13 @@ extension ProcessDataManager {
         
         
         // Process only current selection to save resources
+        // The rest are reparsed when they are next used
         if let currentSelection = dataSource?.currentSelection() {
-            let dataItemsToUpdate = processedDataToUpdate.filter( {id, data in
-                currentSelection.contains(id)
-            })
+            let dataItemsToUpdate = currentSelection.compactMap { processedDataToUpdate[$0] }
             
-            // Directly update the ProcessedData for the current selection
+            // Directly update the ProcessedData for the current selection, in selection order
             Task {
-                for nextData in dataItemsToUpdate.values {
+                for nextData in dataItemsToUpdate {
                     nextData.parserDidChange()
                 }
             }// END: Task
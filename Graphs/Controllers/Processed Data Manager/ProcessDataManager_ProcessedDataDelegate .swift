@@ -17,20 +17,27 @@ extension ProcessDataManager: @preconcurrency ProcessedDataDelegate {
         cacheManager.cacheGraphController(graphController: graphController, for: dataItem)
     }
     
-    func cacheParsedFile(_ parsedFile: ParsedFile, for dataItem: DataItem) {
-        cacheManager.cacheData(parsedFile: parsedFile, for: dataItem)
+    func cacheParsedFile(_ parsedFile: ParsedFile, for dataItem: DataItem, parserSettings: ParserSettingsStatic) {
+        let localCacheManager = cacheManager
+        let dataItemID = dataItem.localID
+        let dataItemURL = dataItem.url
+        
+        // Hashing, encoding and writing run off of the main actor
+        Task(priority: .utility) {
+            await localCacheManager.cacheData(parsedFile: parsedFile, for: dataItemID, sourceURL: dataItemURL, parserSettings: parserSettings)
+        }
     }
     
     
-    func cachedGraph(for dataItem: DataItem) -> DGController? {
+    @MainActor func cachedGraph(for dataItem: DataItem) -> DGController? {
         guard let controller = cacheManager.loadGraphController(for: dataItem) else { return nil }
         
         return controller
     }
     
     
-    func cachedParsedFile(for dataItem: DataItem) -> ParsedFile? {
-        let cachedParsedFile = cacheManager.loadCachedParsedData(for: dataItem)
+    func cachedParsedFile(for dataItem: DataItem, parserSettings: ParserSettingsStatic) async -> ParsedFile? {
+        let cachedParsedFile = await cacheManager.loadCachedParsedData(for: dataItem, parserSettings: parserSettings)
         
         return cachedParsedFile
     }
@@ -45,4 +52,9 @@ extension ProcessDataManager: @preconcurrency ProcessedDataDelegate {
         cacheManager.clearCache(for: dataItems)
     }
     
+    
+    var requiresAllColumns: Bool {
+        return requiresAllParsedColumns
+    }
+    
 }
@@ -69,12 +69,9 @@ struct DataColumn: Codable, Sendable, Identifiable {
         data.append(contentsOf: dataIn)
     }
     
-    func data(for rowNumber: Int) -> String {
-        if rowNumber >= data.count {
-            return ""
-        } else {
-            return data[rowNumber - 1]
-        }
+    /// The value at the zero based index, or an empty string past the end of the column.
+    func value(at index: Int) -> String {
+        index < data.count ? data[index] : ""
     }
     
     
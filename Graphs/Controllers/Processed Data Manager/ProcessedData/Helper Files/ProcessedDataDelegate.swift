@@ -11,12 +11,15 @@ import Foundation
 
 protocol ProcessedDataDelegate {
     
-    func cacheGraphController(_ graphController: GraphController, for dataItem: DataItem)
-    func cacheParsedFile(_ parsedFile: ParsedFile, for dataItem: DataItem)
+    @MainActor func cacheGraphController(_ graphController: GraphController, for dataItem: DataItem)
+    func cacheParsedFile(_ parsedFile: ParsedFile, for dataItem: DataItem, parserSettings: ParserSettingsStatic)
     
-    func cachedGraph(for dataItem: DataItem) -> DGController?
+    @MainActor func cachedGraph(for dataItem: DataItem) -> DGController?
     
-    func cachedParsedFile(for dataItem: DataItem) -> ParsedFile?
+    func cachedParsedFile(for dataItem: DataItem, parserSettings: ParserSettingsStatic) async -> ParsedFile?
     
     func deleteCache(for dataItem: DataItem)
+    
+    /// True if parsed files must contain every column (e.g. the Table Inspector is showing the data).
+    var requiresAllColumns: Bool { get }
 }
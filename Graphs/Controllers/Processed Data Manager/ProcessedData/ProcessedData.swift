@@ -27,6 +27,12 @@ class ProcessedData: Identifiable {
     
     var graphTemplateState: ProcessedDataState
     
+    /// Set when the data file changed on disk after it was parsed.
+    var hasChangedDataFile = false
+    
+    /// Set when the Graph Template file (or the data file) changed on disk after the graph was made.
+    var hasChangedGraphTemplateFile = false
+    
     
     // MARK: - Initialization
     init(dataItem: DataItem, delegate: ProcessedDataDelegate) async {
@@ -58,8 +64,9 @@ class ProcessedData: Identifiable {
     
     // MARK: - Loading Graph
     
+    @MainActor
     func graphCacheState() -> CachedState {
-        let cm = CacheManager()
+        let cm = CacheManager.shared
         
         return cm.graphCacheState(for: dataItem)
     }
@@ -79,14 +86,19 @@ class ProcessedData: Identifiable {
         case .notProcessed: break
         }
         
-        // TODO: Implement Caching
-        /*
-         if self.graphCacheState() == .cachedStorageUpToDate {
-         if let cachedGraph = delegate?.cachedGraph(for: dataItem) {
-         self.graphController =  await GraphController(dgController: cachedGraph, data: nil)
-         }
-         }
-         */
+        // A cached graph already contains the parsed data, so neither the data file nor the template is read
+        if await self.graphCacheState() == .cachedStorageUpToDate,
+           let cachedGraph = await delegate?.cachedGraph(for: dataItem) {
+            hasChangedGraphTemplateFile = false
+            
+            let localGraphController = await GraphController(dgController: cachedGraph, data: nil, dataItemID: dataItem.localID)
+            
+            // The Data Item may have been renamed since the graph was cached
+            await localGraphController.setGraphTitle(graphTitle)
+            
+            self.graphController = localGraphController
+            return
+        }
         
         let localParsedFile = try await self.loadParsedFile()
         
@@ -94,10 +106,26 @@ class ProcessedData: Identifiable {
             return
         }
         
-        let localGraphController = await GraphController(from: graphTemplate.url, data: localParsedFile?.data)
+        let dataItemID = dataItem.localID
+        let numberOfRows = localParsedFile?.data.first?.data.count ?? 0
+        
+        let interval = PipelineTrace.begin(.loadGraphController, dataItemID: dataItemID)
+        
+        // Changes made while the template is read are reported again
+        hasChangedGraphTemplateFile = false
+        
+        let templateInterval = PipelineTrace.begin(.loadGraphTemplate, dataItemID: dataItemID)
+        let templateDGController = DGController(contentsOfFile: graphTemplate.url.path(percentEncoded: false))
+        templateInterval.end()
+        
+        let localGraphController = await GraphController(dgController: templateDGController, data: localParsedFile?.data, dataItemID: dataItemID)
         
         await localGraphController.setGraphTitle(graphTitle)
         
+        let graphSeconds = interval.end(rows: numberOfRows)
+        
+        await ProcessingProfileStore.shared.update(dataItemID) { $0.graphSeconds = graphSeconds }
+        
         self.graphController = localGraphController
     }
     
@@ -127,7 +155,7 @@ class ProcessedData: Identifiable {
             return .notProcessed
         }
         
-        if parsedFile.lastParsedDate < settingsDate {
+        if hasChangedDataFile || parsedFile.lastParsedDate < settingsDate {
             return .outOfDate
         }
         
@@ -137,19 +165,16 @@ class ProcessedData: Identifiable {
     
     @MainActor
     private func determineGraphControllerState() -> ProcessedDataState {
-        guard let graphTemplate = dataItem.getAssociatedGraphTemplate() else {
+        guard dataItem.getAssociatedGraphTemplate() != nil else {
             return .noTemplate
         }
         
-        guard let graphController else {
+        guard graphController != nil else {
             return .notProcessed
         }
         
-        guard let templateDate = graphTemplate.url.dateLastModified else {
-            return .noTemplate
-        }
-        
-        if graphController.lastModified < templateDate {
+        // Changes to the template file are reported by the FileChangeMonitor instead of reading its date on every use
+        if hasChangedGraphTemplateFile {
             return .outOfDate
         }
         
@@ -161,14 +186,51 @@ class ProcessedData: Identifiable {
     
     
     // MARK: - Handling Changes
+    @MainActor
+    func setParsedFile(_ parsedFile: ParsedFile?) {
+        self.parsedFile = parsedFile
+    }
+    
+    
+    /// The data file changed on disk.  The file is parsed and graphed again the next time it is used.
+    func dataFileDidChange() {
+        hasChangedDataFile = true
+        hasChangedGraphTemplateFile = true
+        parsedFileState = .outOfDate
+        graphTemplateState = .outOfDate
+    }
+    
+    
+    /// The Graph Template file changed on disk.  The graph is made again the next time it is used.
+    func graphTemplateFileDidChange() {
+        hasChangedGraphTemplateFile = true
+        graphTemplateState = .outOfDate
+    }
+    
+    
+    /// Reparses and regraphs after `dataFileDidChange()` or `graphTemplateFileDidChange()`.
+    func reloadChangedFiles() async {
+        if hasChangedDataFile {
+            let localParsedFile = try? await self.loadParsedFile()
+            await self.setParsedFile(localParsedFile)
+        }
+        
+        do {
+            try await self.loadGraphController()
+        } catch {
+            Logger.processingData.info("Could not reload the graph of: \(self.dataItem.name)")
+        }
+    }
+    
+    
+
     func parserDidChange() {
         self.parsedFileState = .outOfDate
         
         Task {
             let localParsedFile = try? await self.loadParsedFile()
             _ = await MainActor.run {
-                self.parsedFile = localParsedFile
-                
+                self.setParsedFile(localParsedFile)
             }
             try? await self.loadGraphController()
         }
@@ -195,6 +257,13 @@ class ProcessedData: Identifiable {
         let newDGcontroller = DGController(contentsOfFile: graphTemplateURL.path(percentEncoded: false))
         
         Task {
+            // A projected ParsedFile may not contain every column used by the new Graph Template
+            if self.parsedFile?.isProjected == true {
+                self.parsedFileState = .outOfDate
+                let localParsedFile = try? await self.loadParsedFile()
+                await self.setParsedFile(localParsedFile)
+            }
+            
             await MainActor.run {
                 self.graphController?.setDGController(withController: newDGcontroller, andData: self.parsedFile?.data)
             }
@@ -12,12 +12,14 @@ import Foundation
 // MARK: - Cached Data and Graphs
 extension ProcessedData {
     
+    @MainActor
     func cacheProcessedData() throws {
         cacheGraphController()
         cacheParsedFile()
     }
     
     
+    @MainActor
     func cacheGraphController() {
         
         guard let graphController else { return }
@@ -29,19 +31,21 @@ extension ProcessedData {
     func cacheParsedFile() {
         guard let parsedFile else { return }
         
-        delegate?.cacheParsedFile(parsedFile, for: dataItem)
+        guard let parserSettings = dataItem.getAssociatedParserSettings()?.parserSettingsStatic else { return }
+        
+        delegate?.cacheParsedFile(parsedFile, for: dataItem, parserSettings: parserSettings)
     }
     
     
-    func cachedParsedData() throws -> ParsedFile? {
+    /// The cached ParsedFile if it is up to date, or if the same content was cached for another Data Item.
+    func cachedParsedData(parserSettings: ParserSettingsStatic) async -> ParsedFile? {
         
         switch self.parsedFileState {
             case .noTemplate: return nil
-            case .outOfDate: return nil
             default: break
         }
         
-        let cachedParsedFile = delegate?.cachedParsedFile(for: dataItem)
+        let cachedParsedFile = await delegate?.cachedParsedFile(for: dataItem, parserSettings: parserSettings)
         
         return cachedParsedFile
     }
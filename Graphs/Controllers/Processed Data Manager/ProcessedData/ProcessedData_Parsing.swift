@@ -7,6 +7,7 @@
 //
 
 import Foundation
+import OSLog
 
 extension ProcessedData {
     // MARK: - Load ParsedFile
@@ -23,18 +24,50 @@ extension ProcessedData {
             
             self.parsedFileState = .processing
             
-            guard let staticParserSettings = dataItem.getAssociatedParserSettings()?.parserSettingsStatic else {
+            // Changes made while the file is parsed are reported again
+            self.hasChangedDataFile = false
+            
+            guard let parserSettings = dataItem.getAssociatedParserSettings() else {
                 self.parsedFileState = .noTemplate
                 parsedfile = nil
                 
                 return parsedfile
             }
             
+            let staticParserSettings = parserSettings.parserSettingsStatic
+            
             let dataItemURL = dataItem.url
             let dataItemID = dataItem.localID
             //let dataItemName = dataItem.name
             
-            parsedfile = try await Parser.parse(dataItemURL, using: staticParserSettings, into: dataItemID)
+            // A cached file has every column, so it can be used with any projection
+            if let cachedParsedFile = await self.cachedParsedData(parserSettings: staticParserSettings) {
+                await ProcessingProfileStore.shared.update(dataItemID) { $0.cacheHit = true }
+                self.parsedFileState = .upToDate
+                
+                return cachedParsedFile
+            }
+            
+            let projection = await columnProjection()
+            
+            let signature = FileSignature(contentsOf: dataItemURL)
+            
+            let interval = PipelineTrace.begin(.loadParsedFile, dataItemID: dataItemID)
+            
+            parsedfile = try await Parser.parse(dataItemURL, using: staticParserSettings, into: dataItemID, projection: projection)
+            
+            let parseSeconds = interval.end(bytes: parsedfile?.content.utf8.count ?? 0, rows: parsedfile?.data.first?.data.count ?? 0)
+            
+            if let parsedfile {
+                await ProcessingProfileStore.shared.update(dataItemID) { $0.update(with: parsedfile, parseSeconds: parseSeconds) }
+            }
+            
+            await CacheManifest.shared.recordParse(of: dataItemID, signature: signature)
+            
+            // Only files with every column are cached.  Recorded after the parse so the cached file matches its signature
+            if let parsedfile, !parsedfile.isProjected {
+                delegate?.cacheParsedFile(parsedfile, for: dataItem, parserSettings: staticParserSettings)
+            }
             
             self.parsedFileState = .upToDate
         }
@@ -62,4 +95,41 @@ extension ProcessedData {
         
         return parsedfile
     }
+    
+    
+    
+    // MARK: - Column Projection
+    /// Columns that need to be parsed for the Data Item.
+    ///
+    /// Only the columns consumed by the Graph Template are parsed unless there is no Graph Template or the delegate requires every column.
+    func columnProjection() async -> ColumnProjection {
+        if delegate?.requiresAllColumns ?? true { return .allColumns }
+        
+        guard let graphTemplateURL = dataItem.getAssociatedGraphTemplate()?.url else {
+            return .allColumns
+        }
+        
+        guard let numberOfTemplateColumns = await GraphController.numberOfTemplateColumns(forTemplateAt: graphTemplateURL) else {
+            return .allColumns
+        }
+        
+        return ColumnProjection(numberOfGraphTemplateColumns: numberOfTemplateColumns)
+    }
+    
+    
+    /// Reparses the file with every column if the current ParsedFile was parsed with a ColumnProjection.
+    func loadAllColumns() async {
+        guard parsedFile?.isProjected == true else { return }
+        
+        parsedFileState = .outOfDate
+        
+        do {
+            let localParsedFile = try await self.loadParsedFile()
+            await MainActor.run {
+                self.setParsedFile(localParsedFile)
+            }
+        } catch {
+            Logger.parsing.info("Could not load all columns for: \(self.dataItem.name)")
+        }
+    }
 }
@@ -0,0 +1,57 @@
+//
+//  ColumnStatistics.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// Summary of the values of one column of a ParsedFile, used to sanity check a file without exporting it.
+///
+/// Cells are read as numbers.  Empty cells and cells that are not finite numbers (e.g. text, "NaN" or "inf") are counted but don't take part in the other values.  If a column has no numbers, its minimum, maximum, mean and standard deviation are 0.
+struct ColumnStatistics: Codable, Sendable, Equatable {
+
+    /// Number of cells that are finite numbers.
+    var numberOfValues: Int = 0
+
+    /// Number of non empty cells that are not finite numbers.
+    var numberOfNaNs: Int = 0
+
+    var numberOfEmptyCells: Int = 0
+
+    var minimum: Double = 0
+
+    var maximum: Double = 0
+
+    var mean: Double = 0
+
+    /// Sample standard deviation.  0 for fewer than two values.
+    var standardDeviation: Double = 0
+
+    /// Order of the numbers from the first row to the last.  Cells that are not numbers are skipped.
+    var monotonicity: Monotonicity = .none
+
+
+    /// Number of cells in the column.
+    var numberOfCells: Int {
+        numberOfValues + numberOfNaNs + numberOfEmptyCells
+    }
+
+
+    enum Monotonicity: String, Codable, Sendable {
+        /// Every number is equal to the previous one.
+        case constant
+
+        /// Every number is greater than or equal to the previous one.
+        case increasing
+
+        /// Every number is less than or equal to the previous one.
+        case decreasing
+
+        /// The numbers go up and down, or there are fewer than two numbers.
+        case none
+    }
+}
@@ -0,0 +1,173 @@
+//
+//  ColumnStatisticsStore.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+import OSLog
+
+
+/// Keeps the ColumnStatistics of the cached ParsedFiles and stores them with the cache.
+///
+/// Statistics are keyed by the ContentKey of the ParsedFile, so Data Items that share a cached file share its statistics, and they are removed with the file.  They are read from `URL.columnStatisticsURL` on first use and written back shortly after they change.
+@Observable
+@MainActor
+final class ColumnStatisticsStore {
+    static let shared = ColumnStatisticsStore()
+
+    private(set) var statistics: [ContentKey : [ColumnStatistics]] = [:]
+
+    /// Zero based index of the parsed column whose statistics are shown in the Data List.
+    var dataListColumnIndex: Int {
+        didSet {
+            UserDefaults.standard.set(dataListColumnIndex, forKey: UserDefaults.dataListStatisticsColumn)
+        }
+    }
+
+    /// Statistic changes are written once no further changes arrive within this delay.
+    static let saveDelay: Duration = .seconds(2)
+
+    @ObservationIgnored
+    private var pendingSave: Task<Void, Never>?
+
+
+    private init() {
+        self.statistics = ColumnStatisticsStore.loadStatistics()
+        self.dataListColumnIndex = UserDefaults.standard.object(forKey: UserDefaults.dataListStatisticsColumn) as? Int ?? UserDefaults.defaultDataListStatisticsColumn
+    }
+
+
+
+    // MARK: - Accessing Statistics
+    func statistics(for contentKey: ContentKey) -> [ColumnStatistics]? {
+        statistics[contentKey]
+    }
+
+
+    /// Statistics of the ParsedFile that the CacheManifest lists for the Data Item, or nil if it isn't cached.
+    func statistics(of dataItemID: DataItem.LocalID) -> [ColumnStatistics]? {
+        guard let contentKey = CacheManifest.shared.cachedFile(.parsedFile, of: dataItemID)?.contentKey else { return nil }
+
+        return statistics[contentKey]
+    }
+
+
+    /// Statistics of the Data List column of the Data Item, or nil if they aren't cached or the file has fewer columns.
+    func dataListStatistics(of dataItemID: DataItem.LocalID) -> ColumnStatistics? {
+        guard let columnStatistics = statistics(of: dataItemID),
+              columnStatistics.indices.contains(dataListColumnIndex) else { return nil }
+
+        return columnStatistics[dataListColumnIndex]
+    }
+
+
+    func record(_ columnStatistics: [ColumnStatistics], for contentKey: ContentKey) {
+        if statistics[contentKey] == columnStatistics { return }
+
+        statistics[contentKey] = columnStatistics
+        scheduleSave()
+    }
+
+
+
+    // MARK: - Removing Statistics
+    /// Removes the statistics of the parsed files that were removed from the cache.
+    func removeStatistics(of storedFiles: [CacheManifest.StoredFile]) {
+        var didChange = false
+
+        for case .parsedFile(let contentKey) in storedFiles {
+            didChange = statistics.removeValue(forKey: contentKey) != nil || didChange
+        }
+
+        if didChange {
+            scheduleSave()
+        }
+    }
+
+
+    /// Removes the statistics of parsed files that aren't in `storedFiles`, e.g. of files removed by an older version.
+    func removeStatistics(keeping storedFiles: [CacheManifest.StoredFile]) {
+        var storedContentKeys: Set<ContentKey> = []
+
+        for case .parsedFile(let contentKey) in storedFiles {
+            storedContentKeys.insert(contentKey)
+        }
+
+        let numberOfStatistics = statistics.count
+
+        statistics = statistics.filter { storedContentKeys.contains($0.key) }
+
+        if statistics.count != numberOfStatistics {
+            scheduleSave()
+        }
+    }
+
+
+    func removeAllStatistics() {
+        statistics.removeAll()
+        scheduleSave()
+    }
+
+
+
+    // MARK: - Storage
+    private func scheduleSave() {
+        pendingSave?.cancel()
+
+        pendingSave = Task {
+            try? await Task.sleep(for: ColumnStatisticsStore.saveDelay)
+
+            if Task.isCancelled { return }
+
+            self.pendingSave = nil
+            self.save()
+        }
+    }
+
+
+    /// Writes pending changes before returning, e.g. when the app quits.
+    func flush() {
+        guard let pendingSave else { return }
+
+        pendingSave.cancel()
+        self.pendingSave = nil
+
+        save()
+    }
+
+
+    private func save() {
+        let url = URL.columnStatisticsURL
+
+        let encoder = PropertyListEncoder()
+        encoder.outputFormat = .binary
+
+        do {
+            try FileManager.default.createDirectory(at: url.deletingLastPathComponent(), withIntermediateDirectories: true)
+
+            // Property lists store the infinities of columns with very large values, which JSON can't
+            let data = try encoder.encode(statistics)
+            try data.write(to: url, options: .atomic)
+        } catch {
+            Logger.processingData.error("Could not save column statistics to: \(url.path())")
+            Logger.processingData.error("\(error.localizedDescription)")
+        }
+    }
+
+
+    private static func loadStatistics() -> [ContentKey : [ColumnStatistics]] {
+        let url = URL.columnStatisticsURL
+
+        guard let data = try? Data(contentsOf: url) else { return [:] }
+
+        guard let statistics = try? PropertyListDecoder().decode([ContentKey : [ColumnStatistics]].self, from: data) else {
+            Logger.processingData.info("Discarding unreadable column statistics at: \(url.path())")
+            return [:]
+        }
+
+        return statistics
+    }
+}
@@ -0,0 +1,289 @@
+//
+//  ColumnStatistics_Computing.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+// MARK: - Computing
+/// The cells of a column are read as numbers and reduced with SIMD vectors.  Columns longer than `chunkSize` are split into chunks that are reduced in parallel and then combined in row order.
+extension ColumnStatistics {
+
+    /// Number of rows reduced by one task.
+    static let chunkSize = 65_536
+
+
+    /// The statistics of every column of the ParsedFile, in the order of its columns.
+    static func statistics(of parsedFile: ParsedFile) async -> [ColumnStatistics] {
+        var output: [ColumnStatistics] = []
+        output.reserveCapacity(parsedFile.data.count)
+
+        for nextColumn in parsedFile.data {
+            output.append(await statistics(of: nextColumn.data))
+        }
+
+        return output
+    }
+
+
+    static func statistics(of cells: [String]) async -> ColumnStatistics {
+        let chunkSize = ColumnStatistics.chunkSize
+
+        if cells.count <= chunkSize {
+            return ColumnSummary(cells[...]).statistics
+        }
+
+        let numberOfChunks = (cells.count + chunkSize - 1) / chunkSize
+
+        let summaries = await withTaskGroup(of: (Int, ColumnSummary).self) { group in
+            for nextChunk in 0 ..< numberOfChunks {
+                group.addTask {
+                    let start = nextChunk * chunkSize
+                    let end = min(start + chunkSize, cells.count)
+
+                    return (nextChunk, ColumnSummary(cells[start ..< end]))
+                }
+            }
+
+            var summaries = [ColumnSummary](repeating: ColumnSummary(), count: numberOfChunks)
+
+            for await (nextChunk, nextSummary) in group {
+                summaries[nextChunk] = nextSummary
+            }
+
+            return summaries
+        }
+
+        // Combined in row order, so that the order across the chunk boundaries is checked
+        return summaries.dropFirst().reduce(summaries[0]) { $0.combined(with: $1) }.statistics
+    }
+}
+
+
+
+// MARK: - Column Summary
+/// Partial statistics of consecutive rows, which can be combined with the summary of the rows that follow them.
+private struct ColumnSummary: Sendable {
+
+    typealias Vector = SIMD8<Double>
+
+    var numberOfValues = 0
+    var numberOfNaNs = 0
+    var numberOfEmptyCells = 0
+
+    var minimum = Double.infinity
+    var maximum = -Double.infinity
+    var mean = 0.0
+
+    /// Sum of the squared deviations from the mean.
+    var squaredDeviations = 0.0
+
+    var first = 0.0
+    var last = 0.0
+
+    var isNondecreasing = true
+    var isNonincreasing = true
+
+
+    init() { }
+
+
+    init(_ cells: ArraySlice<String>) {
+        var values: [Double] = []
+        values.reserveCapacity(cells.count)
+
+        for nextCell in cells {
+            if nextCell.isEmpty {
+                numberOfEmptyCells += 1
+            } else if let value = ColumnSummary.number(from: nextCell) {
+                values.append(value)
+            } else {
+                numberOfNaNs += 1
+            }
+        }
+
+        values.withUnsafeBufferPointer { reduce($0) }
+    }
+
+
+    /// The finite number in the cell, allowing surrounding spaces.
+    private static func number(from cell: String) -> Double? {
+        guard let value = Double(cell) ?? Double(cell.trimmingCharacters(in: .whitespaces)),
+              value.isFinite else { return nil }
+
+        return value
+    }
+
+
+
+    // MARK: Reducing
+    private mutating func reduce(_ values: UnsafeBufferPointer<Double>) {
+        let count = values.count
+
+        guard count > 0 else { return }
+
+        let width = Vector.scalarCount
+        let vectorEnd = count - count % width
+
+        // Sum, minimum and maximum
+        var sums = Vector(repeating: 0)
+        var minimums = Vector(repeating: .infinity)
+        var maximums = Vector(repeating: -.infinity)
+
+        var index = 0
+
+        while index < vectorEnd {
+            let next = ColumnSummary.load(values, at: index)
+
+            sums += next
+            minimums = pointwiseMin(minimums, next)
+            maximums = pointwiseMax(maximums, next)
+
+            index += width
+        }
+
+        var sum = sums.sum()
+        var minimum = minimums.min()
+        var maximum = maximums.max()
+
+        while index < count {
+            let next = values[index]
+
+            sum += next
+            minimum = Swift.min(minimum, next)
+            maximum = Swift.max(maximum, next)
+
+            index += 1
+        }
+
+        let mean = sum / Double(count)
+
+        // Squared deviations from the mean, which keeps the variance accurate for values far from 0
+        let means = Vector(repeating: mean)
+        var squares = Vector(repeating: 0)
+
+        index = 0
+
+        while index < vectorEnd {
+            let deviation = ColumnSummary.load(values, at: index) - means
+            squares += deviation * deviation
+
+            index += width
+        }
+
+        var squaredDeviations = squares.sum()
+
+        while index < count {
+            let deviation = values[index] - mean
+            squaredDeviations += deviation * deviation
+
+            index += 1
+        }
+
+        // Each value is compared with the next one, a vector of pairs at a time, until both orders are ruled out
+        var isNondecreasing = true
+        var isNonincreasing = true
+
+        index = 0
+
+        while index + width < count, isNondecreasing || isNonincreasing {
+            let current = ColumnSummary.load(values, at: index)
+            let next = ColumnSummary.load(values, at: index + 1)
+
+            if any(next .< current) { isNondecreasing = false }
+            if any(next .> current) { isNonincreasing = false }
+
+            index += width
+        }
+
+        while index + 1 < count, isNondecreasing || isNonincreasing {
+            if values[index + 1] < values[index] { isNondecreasing = false }
+            if values[index + 1] > values[index] { isNonincreasing = false }
+
+            index += 1
+        }
+
+        self.numberOfValues = count
+        self.minimum = minimum
+        self.maximum = maximum
+        self.mean = mean
+        self.squaredDeviations = squaredDeviations
+        self.first = values[0]
+        self.last = values[count - 1]
+        self.isNondecreasing = isNondecreasing
+        self.isNonincreasing = isNonincreasing
+    }
+
+
+    private static func load(_ values: UnsafeBufferPointer<Double>, at index: Int) -> Vector {
+        UnsafeRawPointer(values.baseAddress! + index).loadUnaligned(as: Vector.self)
+    }
+
+
+
+    // MARK: Combining
+    /// The summary of these rows followed by the rows of `other`.
+    ///
+    /// Means and squared deviations are combined with the parallel algorithm of Chan et al., so the chunks don't have to be reduced again.
+    func combined(with other: ColumnSummary) -> ColumnSummary {
+        let numberOfNaNs = self.numberOfNaNs + other.numberOfNaNs
+        let numberOfEmptyCells = self.numberOfEmptyCells + other.numberOfEmptyCells
+
+        var output: ColumnSummary
+
+        if other.numberOfValues == 0 {
+            output = self
+        } else if numberOfValues == 0 {
+            output = other
+        } else {
+            let numberOfValues = self.numberOfValues + other.numberOfValues
+            let delta = other.mean - mean
+            let ownWeight = Double(self.numberOfValues)
+            let otherWeight = Double(other.numberOfValues)
+
+            output = self
+            output.numberOfValues = numberOfValues
+            output.minimum = Swift.min(minimum, other.minimum)
+            output.maximum = Swift.max(maximum, other.maximum)
+            output.mean = mean + delta * otherWeight / Double(numberOfValues)
+            output.squaredDeviations = squaredDeviations + other.squaredDeviations + delta * delta * ownWeight * otherWeight / Double(numberOfValues)
+            output.last = other.last
+            output.isNondecreasing = isNondecreasing && other.isNondecreasing && last <= other.first
+            output.isNonincreasing = isNonincreasing && other.isNonincreasing && last >= other.first
+        }
+
+        output.numberOfNaNs = numberOfNaNs
+        output.numberOfEmptyCells = numberOfEmptyCells
+
+        return output
+    }
+
+
+    var statistics: ColumnStatistics {
+        var output = ColumnStatistics(numberOfValues: numberOfValues, numberOfNaNs: numberOfNaNs, numberOfEmptyCells: numberOfEmptyCells)
+
+        guard numberOfValues > 0 else { return output }
+
+        output.minimum = minimum
+        output.maximum = maximum
+        output.mean = mean
+
+        if numberOfValues > 1 {
+            output.standardDeviation = (squaredDeviations / Double(numberOfValues - 1)).squareRoot()
+        }
+
+        switch (numberOfValues > 1, isNondecreasing, isNonincreasing) {
+        case (false, _, _): output.monotonicity = .none
+        case (true, true, true): output.monotonicity = .constant
+        case (true, true, false): output.monotonicity = .increasing
+        case (true, false, true): output.monotonicity = .decreasing
+        case (true, false, false): output.monotonicity = .none
+        }
+
+        return output
+    }
+}
@@ -127,7 +127,7 @@ extension SelectionManager {
 extension SelectionManager {
     
     
-    func preparingToDelete(nodes: [Node]) {
+    func preparingToDelete(nodes: [Node], containing dataItems: [DataItem]) {
         
         if nodes.count == 0 {
             return
@@ -141,15 +141,8 @@ extension SelectionManager {
         }
         
         
-        // Make sure any possible dataItems aren't selected
-        var dataItems: Set<DataItem> = []
-        
-        for nextNode in nodes {
-            dataItems.formUnion(nextNode.flattenedDataItems())
-        }
-        
         // Clear out the selected Data Items
-        self.preparingToDelete(dataItems: Array(dataItems))
+        self.preparingToDelete(dataItems: dataItems)
                 
         
         // Next Clear out any deleted Nodes
@@ -0,0 +1,212 @@
+//
+//  SessionManager.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+import AppKit
+import OSLog
+
+
+/// Saves the workspace as a SessionSnapshot and restores it at launch.
+///
+/// The snapshot is written shortly after the selection changes, periodically while the app runs, and when the app quits.  Graphs of the selected Data Items are cached before each write, so that the restored selection is shown from its cached graphs without reading the data files or the Graph Templates.
+@MainActor
+final class SessionManager {
+
+    /// Selection changes are saved once no further changes arrive within this delay.
+    static let saveDelay: Duration = .seconds(5)
+
+    /// Processed Data is saved this often, e.g. after a background parse finished.
+    static let saveInterval: Duration = .seconds(60)
+
+    private let dataController: DataController
+    private let selectionManager: SelectionManager
+    private let processedDataManager: ProcessDataManager
+    private let cacheManager: CacheManager
+
+    private var lastSavedSnapshot: SessionSnapshot?
+
+    private var pendingSave: Task<Void, Never>?
+
+    private var periodicSave: Task<Void, Never>?
+
+    private var terminationObserver: NSObjectProtocol?
+
+
+    init(_ dataController: DataController, _ selectionManager: SelectionManager, _ processedDataManager: ProcessDataManager, _ cacheManager: CacheManager) {
+        self.dataController = dataController
+        self.selectionManager = selectionManager
+        self.processedDataManager = processedDataManager
+        self.cacheManager = cacheManager
+    }
+
+
+
+    // MARK: - Restoring
+    /// Selects the Nodes and Data Items of the last session and processes its other Data Items in the background.
+    ///
+    /// - Returns: False if there is no session to restore, e.g. at the first launch.
+    @discardableResult
+    func restoreLastSession() -> Bool {
+        guard let snapshot = SessionManager.loadSnapshot() else { return false }
+
+        lastSavedSnapshot = snapshot
+
+        // Objects deleted since the snapshot was written are skipped
+        let nodeIDs = snapshot.selectedNodeIDs.compactMap { dataController.nodesByLocalID[$0]?.id }
+
+        guard !nodeIDs.isEmpty else { return false }
+
+        // Selecting the Nodes fetches their Data Items ahead of the other pages
+        selectionManager.selectedNodeIDs = Set(nodeIDs)
+
+        let dataItems = snapshot.selectedDataItemIDs.compactMap { dataController.dataItemsByLocalID[$0] }
+
+        // The selected Data Items are processed in parallel and read from their cached graphs
+        if !dataItems.isEmpty {
+            selectionManager.selectedDataItemIDs = Set(dataItems.map { $0.id })
+        }
+
+        // The other Data Items that were processed are only restored if their cache is still valid, so that no data file is parsed at launch.  Data Items in pages that aren't fetched yet are skipped.
+        let selectedDataItemIDs = Set(snapshot.selectedDataItemIDs)
+        let manifest = CacheManifest.shared
+
+        let backgroundDataItems = snapshot.processedDataItems.compactMap { nextItem -> DataItem? in
+            guard !selectedDataItemIDs.contains(nextItem.dataItemID),
+                  let dataItem = dataController.dataItemsByLocalID[nextItem.dataItemID] else { return nil }
+
+            let hasCachedParsedFile = nextItem.parsedFile.map { manifest.isStored($0) } ?? false
+            let hasCachedGraph = nextItem.hasCachedGraph && cacheManager.graphCacheState(for: dataItem) == .cachedStorageUpToDate
+
+            return hasCachedParsedFile || hasCachedGraph ? dataItem : nil
+        }
+
+        processedDataManager.rehydrate(backgroundDataItems)
+
+        return true
+    }
+
+
+
+    // MARK: - Saving
+    /// Starts the periodic saves and saves when the app quits.
+    func startSaving() {
+        periodicSave?.cancel()
+
+        periodicSave = Task { [weak self] in
+            while !Task.isCancelled {
+                try? await Task.sleep(for: SessionManager.saveInterval)
+
+                if Task.isCancelled { return }
+
+                self?.save()
+            }
+        }
+
+        guard terminationObserver == nil else { return }
+
+        terminationObserver = NotificationCenter.default.addObserver(forName: NSApplication.willTerminateNotification, object: nil, queue: .main) { [weak self] _ in
+            // Posted on the main queue
+            MainActor.assumeIsolated {
+                self?.save()
+
+                // The snapshot refers to cache entries that may still be waiting to be saved
+                CacheManifest.shared.flush()
+                ColumnStatisticsStore.shared.flush()
+            }
+        }
+    }
+
+
+    func selectionDidChange() {
+        pendingSave?.cancel()
+
+        pendingSave = Task {
+            try? await Task.sleep(for: SessionManager.saveDelay)
+
+            if Task.isCancelled { return }
+
+            self.save()
+        }
+    }
+
+
+    func save() {
+        pendingSave?.cancel()
+        pendingSave = nil
+
+        cacheSelectedGraphs()
+
+        let snapshot = currentSnapshot()
+
+        if snapshot == lastSavedSnapshot { return }
+
+        let url = URL.sessionSnapshotURL
+
+        do {
+            try FileManager.default.createDirectory(at: url.deletingLastPathComponent(), withIntermediateDirectories: true)
+
+            let data = try JSONEncoder().encode(snapshot)
+            try data.write(to: url, options: .atomic)
+
+            lastSavedSnapshot = snapshot
+        } catch {
+            Logger.processingData.error("Could not save the session to: \(url.path())")
+            Logger.processingData.error("\(error.localizedDescription)")
+        }
+    }
+
+
+    private func currentSnapshot() -> SessionSnapshot {
+        let manifest = CacheManifest.shared
+
+        var snapshot = SessionSnapshot()
+
+        snapshot.selectedNodeIDs = selectionManager.selectedNodeIDs.compactMap { dataController.nodesByID[$0]?.localID }
+        snapshot.selectedDataItemIDs = dataController.selectedDataItems.map { $0.localID }
+
+        snapshot.processedDataItems = processedDataManager.allLoadedProcessedData.map { nextProcessedData in
+            let dataItemID = nextProcessedData.dataItem.localID
+
+            return SessionSnapshot.ProcessedDataItem(dataItemID: dataItemID,
+                                                     parsedFile: manifest.cachedFile(.parsedFile, of: dataItemID)?.contentKey,
+                                                     hasCachedGraph: manifest.cachedFile(.graph, of: dataItemID) != nil)
+        }
+        .sorted { $0.dataItemID.uuidString < $1.dataItemID.uuidString }
+
+        return snapshot
+    }
+
+
+    /// Caches the up to date graphs of the selected Data Items that are not cached yet.
+    private func cacheSelectedGraphs() {
+        let selectedIDs = Set(dataController.selectedDataItems.map { $0.id })
+
+        for nextProcessedData in processedDataManager.allLoadedProcessedData where selectedIDs.contains(nextProcessedData.dataItem.id) {
+            guard nextProcessedData.parsedFileState == .upToDate,
+                  nextProcessedData.graphTemplateState == .upToDate,
+                  cacheManager.graphCacheState(for: nextProcessedData.dataItem) != .cachedStorageUpToDate else { continue }
+
+            nextProcessedData.cacheGraphController()
+        }
+    }
+
+
+    private static func loadSnapshot() -> SessionSnapshot? {
+        let url = URL.sessionSnapshotURL
+
+        guard let data = try? Data(contentsOf: url) else { return nil }
+
+        guard let snapshot = try? JSONDecoder().decode(SessionSnapshot.self, from: data),
+              snapshot.version == SessionSnapshot.currentVersion else {
+            Logger.processingData.info("Discarding unreadable session at: \(url.path())")
+            return nil
+        }
+
+        return snapshot
+    }
+}
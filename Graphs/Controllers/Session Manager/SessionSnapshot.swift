@@ -0,0 +1,39 @@
+//
+//  SessionSnapshot.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// The workspace when the app was last used: the selection and the Data Items that were processed, with references to their cached files.
+///
+/// Objects are referred to by their local IDs, so the snapshot stays valid when the store reassigns persistent identifiers.
+struct SessionSnapshot: Codable, Equatable {
+
+    /// Snapshots with another version are discarded.
+    static let currentVersion = 1
+
+    var version = SessionSnapshot.currentVersion
+
+    var selectedNodeIDs: [Node.LocalID] = []
+
+    /// In the order they are shown in the Data List.
+    var selectedDataItemIDs: [DataItem.LocalID] = []
+
+    var processedDataItems: [ProcessedDataItem] = []
+
+
+    /// A processed Data Item and the cached files it can be restored from.
+    struct ProcessedDataItem: Codable, Equatable {
+        var dataItemID: DataItem.LocalID
+
+        /// Key of the cached ParsedFile, if it was cached.
+        var parsedFile: ContentKey?
+
+        var hasCachedGraph: Bool
+    }
+}
@@ -47,29 +47,6 @@ struct ParserSettingsStatic: Codable, Sendable {
     
     var hasFooter: Bool
     
-    init(using parserSettings: ParserSettings) {
-        self.name = parserSettings.name
-        self.localID = parserSettings.localID
-        self.creationDate = parserSettings.creationDate
-        self.lastModified = parserSettings.lastModified
-        self.newLineType = parserSettings.newLineType
-        self.stringEncodingType = parserSettings.stringEncodingType
-        self.hasExperimentalDetails = parserSettings.hasExperimentalDetails
-        self.experimentalDetailsSeparator = parserSettings.experimentalDetailsSeparator
-        self.experimentalDetailsStart = parserSettings.experimentalDetailsStart
-        self.experimentalDetailsEnd = parserSettings.experimentalDetailsEnd
-        self.hasHeader = parserSettings.hasHeader
-        self.headerSeparator = parserSettings.headerSeparator
-        self.headerStart = parserSettings.headerStart
-        self.headerEnd = parserSettings.headerEnd
-        self.hasData = parserSettings.hasData
-        self.dataStart = parserSettings.dataStart
-        self.dataSeparator = parserSettings.dataSeparator
-        self.stopDataAtFirstEmptyLine = parserSettings.stopDataAtFirstEmptyLine
-        self.hasFooter = parserSettings.hasFooter
-    }
-    
-    
     func parseLineType(for index: Int) -> ParseLineType {
         
         switch index {
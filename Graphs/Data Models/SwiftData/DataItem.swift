@@ -24,21 +24,8 @@ final class DataItem: Identifiable, Hashable {
     
     var graphTemplate: GraphTemplate?
     
-    var parserSettings: ParserSettings? {
-        didSet {
-            let nc = NotificationCenter.default
-            
-            let info: [String: Any] = [
-                Notification.UserInfoKey.dataItemIDs : [id],
-                
-                Notification.UserInfoKey.oldParserSettingID : oldValue.id,
-                
-                Notification.UserInfoKey.newParserSettingID : parserSettings.id
-            ]
-            
-            nc.post(name: .parserOnDataItemDidChange, object: nil, userInfo: info)
-        }
-    }
+    /// Set with `setParserSetting(withInputType:and:)`, which posts the change.
+    var parserSettings: ParserSettings?
     
     
     var creationDate: Date
@@ -53,9 +40,6 @@ final class DataItem: Identifiable, Hashable {
     
     var userNotes: String = ""
     
-    @Transient
-    private var resourceValues: URLResourceValues?
-    
     
     
     // MARK: - Initialization
@@ -74,6 +58,22 @@ final class DataItem: Identifiable, Hashable {
     }
     
     
+    /// Creates a Data Item with a bookmark that was already created (e.g. while scanning a directory off of the main actor).
+    init(url: URL, bookmarkData: Data?) {
+        self.localID = LocalID()
+        
+        self.url = url
+        self.name = url.fileName ?? "No File Name"
+        self.node = nil
+        
+        self.creationDate = .now
+        self.graphTemplateInputType = .none
+        self.parserSettingsInputType = .none
+        
+        self.bookmarkData = bookmarkData
+    }
+    
+    
     func postModelContextInsertInitialization(_ node: Node?) {
         self.node = node
         
@@ -97,26 +97,19 @@ final class DataItem: Identifiable, Hashable {
     
     // MARK: - Names
     @Transient
+    @MainActor
     var graphTemplateName: String {
-        getAssociatedGraphTemplate()?.name ?? "No Graph"
+        EffectiveSettingsResolver.shared.graphTemplate(for: self)?.name ?? "No Graph"
     }
     
     @Transient
+    @MainActor
     var parserSettingsName: String {
-        getAssociatedParserSettings()?.name ?? "No Parser"
-    }
-    
-    
-    // MARK: - URL Resources
-    func urlResources() -> URLResourceValues? {
-        if resourceValues == nil {
-            resourceValues = try? url.resourceValues(forKeys: [.totalFileSizeKey, .creationDateKey, .contentModificationDateKey])
-        }
-        
-        return resourceValues
+        EffectiveSettingsResolver.shared.parserSettings(for: self)?.name ?? "No Parser"
     }
     
     
+    @MainActor
     func setGraphTemplate(withInputType inputType: InputType, and newGraphTemplate: GraphTemplate?) {
         
         // Prepare for posting notification
@@ -146,9 +139,9 @@ final class DataItem: Identifiable, Hashable {
         let nc = NotificationCenter.default
         
         let info: [String: Any] = [
-            "dataItem.ids" : [id],
-            "oldGraphTemplate.id" : oldGraphTemplateID as Any,
-            "newGraphTemplate.id" : newGraphTemplateID as Any
+            Notification.UserInfoKey.dataItemIDs : EffectiveSettingsResolver.shared.graphTemplateDidChange(on: self),
+            Notification.UserInfoKey.oldGraphTemplateID : oldGraphTemplateID as Any,
+            Notification.UserInfoKey.newGraphTemplateID : newGraphTemplateID as Any
         ]
         
         nc.post(name: .graphTemplateDidChange, object: nil, userInfo: info)
@@ -167,6 +160,7 @@ final class DataItem: Identifiable, Hashable {
     }
     
     
+    @MainActor
     func setParserSetting(withInputType inputType: InputType, and newParserSettings: ParserSettings?) {
         
         // Prepare for posting notification
@@ -193,9 +187,9 @@ final class DataItem: Identifiable, Hashable {
         let nc = NotificationCenter.default
         
         let info: [String: Any] = [
-            "dataItem.ids" : [id],
-            "oldGraphTemplate.id" : oldParserSettingID as Any,
-            "newGraphTemplate.id" : newParserSettingID as Any
+            Notification.UserInfoKey.dataItemIDs : EffectiveSettingsResolver.shared.parserSettingsDidChange(on: self),
+            Notification.UserInfoKey.oldParserSettingLocalID : oldParserSettingID as Any,
+            Notification.UserInfoKey.newParserSettingLocalID : newParserSettingID as Any
         ]
         
         nc.post(name: .parserOnNodeOrDataItemDidChange, object: nil, userInfo: info)
@@ -274,6 +268,7 @@ extension DataItem {
 
 // MARK: - Filtering
 extension DataItem {
+    @MainActor
     func containsFilter(_ filter: String) -> Bool {
         
         let lowerCasedFilter = filter.lowercased()
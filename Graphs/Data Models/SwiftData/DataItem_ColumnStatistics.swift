@@ -0,0 +1,67 @@
+//
+//  DataItem_ColumnStatistics.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+import SwiftData
+
+
+// MARK: - Column Statistics
+/// Sortable statistics of the parsed column chosen for the Data List (`ColumnStatisticsStore.dataListColumnIndex`).  Data Items without cached statistics sort as 0.
+extension DataItem {
+
+    @Transient
+    @MainActor
+    var dataListColumnStatistics: ColumnStatistics? {
+        ColumnStatisticsStore.shared.dataListStatistics(of: localID)
+    }
+
+
+    @Transient
+    @MainActor
+    var columnMinimum: Double {
+        dataListColumnStatistics?.minimum ?? 0
+    }
+
+
+    @Transient
+    @MainActor
+    var columnMaximum: Double {
+        dataListColumnStatistics?.maximum ?? 0
+    }
+
+
+    @Transient
+    @MainActor
+    var columnMean: Double {
+        dataListColumnStatistics?.mean ?? 0
+    }
+
+
+    @Transient
+    @MainActor
+    var columnStandardDeviation: Double {
+        dataListColumnStatistics?.standardDeviation ?? 0
+    }
+
+
+    @Transient
+    @MainActor
+    var columnNaNCount: Int {
+        dataListColumnStatistics?.numberOfNaNs ?? 0
+    }
+
+
+    /// "Increasing", "Decreasing", "Constant" or an empty string.
+    @Transient
+    @MainActor
+    var columnMonotonicity: String {
+        guard let dataListColumnStatistics, dataListColumnStatistics.monotonicity != .none else { return "" }
+
+        return dataListColumnStatistics.monotonicity.rawValue.capitalized
+    }
+}
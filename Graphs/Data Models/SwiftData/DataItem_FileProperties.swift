@@ -13,13 +13,23 @@ import SwiftData
 // MARK: - File Properties
 extension DataItem {
 
+    /// Read in the background by the FileMetadataStore.  Nil until the file has been read.
     @Transient
+    @MainActor
+    var fileMetadata: FileMetadata? {
+        FileMetadataStore.shared.metadata(for: url)
+    }
+    
+    
+    @Transient
+    @MainActor
     var fileSize: Int {
-        urlResources()?.totalFileSize ?? 0
+        fileMetadata?.fileSize ?? 0
     }
     
     
     @Transient
+    @MainActor
     var scaledFileSize: String {
         //Source: https://stackoverflow.com/questions/42722498/print-the-size-megabytes-of-data-in-swift
         let bcf = ByteCountFormatter()
@@ -30,16 +40,26 @@ extension DataItem {
     }
     
     @Transient
+    @MainActor
     var contentCreationDate: Date {
-        return urlResources()?.creationDate ?? .distantPast
+        return fileMetadata?.contentCreationDate ?? .distantPast
     }
     
     
     @Transient
+    @MainActor
     var contentModificationDate: Date {
-        return urlResources()?.contentModificationDate ?? .distantPast
+        return fileMetadata?.contentModificationDate ?? .distantPast
     }
     
+    /// True if the file changed on disk since it was last parsed.
+    @Transient
+    @MainActor
+    var hasChangedFile: Bool {
+        CacheManifest.shared.isStale(localID)
+    }
+    
+    
     @Transient
     var fileExists: Bool {
         return self.url.fileExists
@@ -51,9 +71,10 @@ extension DataItem {
         return node?.name ?? "No Folder"
     }
     
-     @Transient
+    @Transient
+    @MainActor
     var nodePath: String {
-        node?.nodePath() ?? ""
+        node.flatMap { NodePathCache.shared.path(of: $0) } ?? ""
     }
     
     
@@ -0,0 +1,74 @@
+//
+//  DataItem_ProcessingProfile.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+import SwiftData
+
+
+// MARK: - Processing Profile
+/// Sortable values of the Data Item's ProcessingProfile.  Data Items that have not been processed sort as 0.
+extension DataItem {
+
+    @Transient
+    @MainActor
+    var processingProfile: ProcessingProfile? {
+        ProcessingProfileStore.shared.profile(for: localID)
+    }
+
+
+    @Transient
+    @MainActor
+    var parseMilliseconds: Double {
+        (processingProfile?.parseSeconds ?? 0) * 1_000
+    }
+
+
+    @Transient
+    @MainActor
+    var graphMilliseconds: Double {
+        (processingProfile?.graphSeconds ?? 0) * 1_000
+    }
+
+
+    @Transient
+    @MainActor
+    var parsedLineCount: Int {
+        processingProfile?.numberOfLines ?? 0
+    }
+
+
+    @Transient
+    @MainActor
+    var parsedRowCount: Int {
+        processingProfile?.numberOfRows ?? 0
+    }
+
+
+    @Transient
+    @MainActor
+    var parsedColumnCount: Int {
+        processingProfile?.numberOfColumns ?? 0
+    }
+
+
+    @Transient
+    @MainActor
+    var peakBytesHeld: Int {
+        processingProfile?.peakBytesHeld ?? 0
+    }
+
+
+    /// "Hit", "Miss" or an empty string if the Data Item has not been processed.
+    @Transient
+    @MainActor
+    var cacheResult: String {
+        guard let processingProfile else { return "" }
+
+        return processingProfile.cacheHit ? "Hit" : "Miss"
+    }
+}
@@ -41,15 +41,12 @@ class GraphTemplate: Identifiable {
     }
     
     
+    @MainActor
     func postModelContextInsertInitialization(_ node: Node?) {
         node?.setGraphTemplate(withInputType: .directlySet, and: self)
     }
     
     
-    @Transient
-    private var resourceValues: URLResourceValues?
-    
-    
 }
 
 
@@ -78,22 +75,23 @@ extension GraphTemplate: SelectableCheck {
 // MARK: - File Properties
 extension GraphTemplate {
     
-    func urlResources() -> URLResourceValues? {
-        if resourceValues == nil {
-            resourceValues = try? url.resourceValues(forKeys: [.totalFileSizeKey, .creationDateKey, .contentModificationDateKey])
-        }
-        
-        return resourceValues
+    /// Read in the background by the FileMetadataStore.  Nil until the file has been read.
+    @Transient
+    @MainActor
+    var fileMetadata: FileMetadata? {
+        FileMetadataStore.shared.metadata(for: url)
     }
     
     
     @Transient
+    @MainActor
     var fileSize: Int {
-        urlResources()?.totalFileSize ?? 0
+        fileMetadata?.fileSize ?? 0
     }
     
     
     @Transient
+    @MainActor
     var scaledFileSize: String {
         //Source: https://stackoverflow.com/questions/42722498/print-the-size-megabytes-of-data-in-swift
         let bcf = ByteCountFormatter()
@@ -104,14 +102,16 @@ extension GraphTemplate {
     }
     
     @Transient
+    @MainActor
     var contentCreationDate: Date {
-        return urlResources()?.creationDate ?? .distantPast
+        return fileMetadata?.contentCreationDate ?? .distantPast
     }
     
     
     @Transient
+    @MainActor
     var contentModificationDate: Date {
-        return urlResources()?.contentModificationDate ?? .distantPast
+        return fileMetadata?.contentModificationDate ?? .distantPast
     }
 }
 
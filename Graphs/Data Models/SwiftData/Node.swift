@@ -30,6 +30,12 @@ final class Node: Identifiable {
         subNodes?.sorted(using: sort)
     }
     
+    /// Sub Nodes without sorting them, for walking the tree.
+    @Transient
+    var unsortedSubNodes: [Node] {
+        subNodes ?? []
+    }
+    
     @Transient
     let sort: [KeyPathComparator<Node>] = [.init(\.name), .init(\.creationDate)]
     
@@ -43,45 +49,15 @@ final class Node: Identifiable {
     //var disclosureIsOpen = false
     
     
-    var graphTemplate: GraphTemplate? {
-        didSet {
-            let nc = NotificationCenter.default
-            
-            let dataItemIDS = flattenedDataItems().map({ $0.id })
-            
-            let info: [String: Any] = [
-                Notification.UserInfoKey.dataItemIDs : dataItemIDS,
-                
-                Notification.UserInfoKey.oldGraphTemplateID : oldValue.id,
-                
-                Notification.UserInfoKey.newGraphTemplateID : parserSettings.id
-            ]
-            
-            nc.post(name: .graphTemplateDidChange, object: nil, userInfo: info)
-        }
-    }
+    /// Set with `setGraphTemplate(withInputType:and:)`, which posts the change.
+    var graphTemplate: GraphTemplate?
     
     
     var graphTemplateInputType: InputType
     
     
-    var parserSettings: ParserSettings? {
-        didSet {
-            let nc = NotificationCenter.default
-            
-            let dataItemIDS = flattenedDataItems().map({ $0.id })
-            
-            let info: [String: Any] = [
-                Notification.UserInfoKey.dataItemIDs : dataItemIDS,
-                
-                Notification.UserInfoKey.oldParserSettingID : oldValue.id,
-                
-                Notification.UserInfoKey.newParserSettingID : parserSettings.id
-            ]
-            
-            nc.post(name: .parserOnNodeOrDataItemDidChange, object: nil, userInfo: info)
-        }
-    }
+    /// Set with `setParserSetting(withInputType:and:)`, which posts the change.
+    var parserSettings: ParserSettings?
     
     var parserSettingsInputType: InputType
     
@@ -144,6 +120,7 @@ final class Node: Identifiable {
     }
     
     
+    @MainActor
     func setGraphTemplate(withInputType inputType: InputType, and newGraphTemplate: GraphTemplate?) {
         
         // Prepare for posting notification
@@ -169,14 +146,15 @@ final class Node: Identifiable {
         // Post Notification
         let nc = NotificationCenter.default
         
-        let dataItemIDs = flattenedDataItems().map( { $0.id } )
+        // Only the Data Items that inherit from this Node are affected
+        let dataItemIDs = EffectiveSettingsResolver.shared.graphTemplateDidChange(on: self)
         
         let info: [String: Any] = [
-            "dataItem.ids" : [dataItemIDs],
+            Notification.UserInfoKey.dataItemIDs : dataItemIDs,
             
-            "oldGraphTemplate.id" : oldGraphTemplateID as Any,
+            Notification.UserInfoKey.oldGraphTemplateID : oldGraphTemplateID as Any,
             
-            "newGraphTemplate.id" : newGraphTemplateID as Any
+            Notification.UserInfoKey.newGraphTemplateID : newGraphTemplateID as Any
         ]
         
         nc.post(name: .graphTemplateDidChange, object: nil, userInfo: info)
@@ -194,6 +172,7 @@ final class Node: Identifiable {
     }
     
     
+    @MainActor
     func setParserSetting(withInputType inputType: InputType, and newParserSettings: ParserSettings?) {
         
         // Prepare for posting notification
@@ -219,7 +198,8 @@ final class Node: Identifiable {
         
         let nc = NotificationCenter.default
         
-        let dataItemIDS = flattenedDataItems().map({ $0.id })
+        // Only the Data Items that inherit from this Node are affected
+        let dataItemIDS = EffectiveSettingsResolver.shared.parserSettingsDidChange(on: self)
         
         let info: [String: Any] = [
             Notification.UserInfoKey.dataItemIDs : dataItemIDS,
@@ -244,27 +224,30 @@ final class Node: Identifiable {
     
 
     
+    /// The Data Items of this Node and all of its sub Nodes.
+    ///
+    /// Visits every Node in the subtree once.  On the main actor, prefer `DataController.dataItems(inSubtreesOf:)`, which uses the NodeSubtreeIndex.
     func flattenedDataItems() -> [DataItem] {
         
         var localItems: [DataItem] = self.dataItems
         
-        let allSubNodes = self.flattendSubNodes()
-        
-        for nextSubNode in allSubNodes {
-            localItems.append(contentsOf: nextSubNode.flattenedDataItems())
+        for nextSubNode in self.flattendSubNodes() {
+            localItems.append(contentsOf: nextSubNode.dataItems)
         }
         
         return localItems
     }
     
     
+    /// Every Node below this Node, parents before their sub Nodes.
     func flattendSubNodes() -> [Node] {
-        let localSubNodes: [Node] = self.subNodes ?? []
+        var output: [Node] = []
         
-        var output: [Node] = localSubNodes
+        var pending: [Node] = (self.subNodes ?? []).reversed()
         
-        for nextSubNodes in localSubNodes {
-            output.append(contentsOf: nextSubNodes.flattendSubNodes())
+        while let nextNode = pending.popLast() {
+            output.append(nextNode)
+            pending.append(contentsOf: (nextNode.subNodes ?? []).reversed())
         }
         
         return output
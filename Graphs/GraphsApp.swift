@@ -24,7 +24,12 @@ struct GraphsApp: App {
         .commands{ AllMenuCommands }
         
         Settings {
-            Preferences(appController.preferencesVM)
+            TabView {
+                Preferences(appController.preferencesVM)
+                    .tabItem { Label("Import Extensions", systemImage: "doc.badge.plus") }
+                CachePreferences(appController.cachePreferencesVM)
+                    .tabItem { Label("Cache", systemImage: "internaldrive") }
+            }
         }
     }
     
@@ -47,6 +52,7 @@ extension GraphsApp {
         ImportMenuCommands
         PasteBoardCommands
         UndoRedoCommands
+        ProcessingStatisticsCommands
     }
     
     
@@ -161,6 +167,29 @@ extension GraphsApp {
     
  
     
+    // MARK: Processing Statistics
+    fileprivate var ProcessingStatisticsCommands: some Commands {
+        CommandGroup(after: .help) {
+            Menu("Processing Statistics") {
+                Button_copyProcessingStatistics
+                Button_resetProcessingStatistics
+            }
+        }
+    }
+    
+    
+    private var Button_copyProcessingStatistics: some View {
+        Button("Copy", action: menuVM.copyProcessingStatistics)
+            .help(menuVM.toolTip_copyProcessingStatistics)
+    }
+    
+    
+    private var Button_resetProcessingStatistics: some View {
+        Button("Reset", action: menuVM.resetProcessingStatistics)
+    }
+    
+    
+    
     // MARK: - Commands to Remove
     private var PasteBoardCommands: some Commands {
         CommandGroup(replacing: .pasteboard, addition: {})
@@ -0,0 +1,94 @@
+//
+//  OperationProgress.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// Progress of a long running operation (e.g. importing a directory tree) that can be shown in the UI and cancelled by the user.
+///
+/// Example Usage
+///```swift
+/// let progress = OperationProgress(title: "Importing")
+/// progress.cancellationHandler = { task.cancel() }
+/// progress.update(phase: "Scanning Folders", completed: 0, total: nil)
+/// ```
+@Observable
+@MainActor
+final class OperationProgress: Identifiable {
+    let id = UUID()
+
+    let title: String
+
+    /// Short description of what the operation is currently doing.
+    private(set) var phase: String = ""
+
+    private(set) var completedUnitCount: Int = 0
+
+    /// Total number of units, or nil while the total is not known yet.
+    private(set) var totalUnitCount: Int? = nil
+
+    private(set) var isCancelled = false
+
+    private(set) var isFinished = false
+
+    /// Called once when the user cancels the operation.
+    @ObservationIgnored
+    var cancellationHandler: (() -> Void)?
+
+
+    init(title: String) {
+        self.title = title
+    }
+
+
+    /// Fraction between 0 and 1, or nil if the total is not known.
+    var fractionCompleted: Double? {
+        guard let totalUnitCount, totalUnitCount > 0 else { return nil }
+
+        return min(Double(completedUnitCount) / Double(totalUnitCount), 1)
+    }
+
+
+    var summary: String {
+        if let totalUnitCount {
+            return "\(phase) \(completedUnitCount.formatted()) of \(totalUnitCount.formatted())"
+        } else if completedUnitCount > 0 {
+            return "\(phase) \(completedUnitCount.formatted())"
+        } else {
+            return phase
+        }
+    }
+
+
+    // MARK: - Updating
+    func update(phase: String, completed: Int = 0, total: Int? = nil) {
+        self.phase = phase
+        self.completedUnitCount = completed
+        self.totalUnitCount = total
+    }
+
+
+    func advance(by count: Int = 1) {
+        completedUnitCount += count
+    }
+
+
+    func finish() {
+        isFinished = true
+        cancellationHandler = nil
+    }
+
+
+    func cancel() {
+        if isCancelled || isFinished { return }
+
+        isCancelled = true
+        cancellationHandler?()
+        cancellationHandler = nil
+    }
+}
@@ -0,0 +1,119 @@
+//
+//  PipelineStatistics.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// Collects the PipelineTrace intervals of the current session and summarizes them per stage.
+final class PipelineStatistics: @unchecked Sendable {
+    static let shared = PipelineStatistics()
+
+    /// Samples kept per stage.  Older samples are overwritten once a stage reaches this count.
+    static let maximumNumberOfSamples = 10_000
+
+    private let lock = NSLock()
+
+    private var stageSamples: [PipelineStage : StageSamples] = [:]
+
+
+    private struct StageSamples {
+        var seconds: [Double] = []
+        var count = 0
+        var totalSeconds = 0.0
+        var bytes = 0
+        var rows = 0
+    }
+
+
+    /// Percentiles and totals for a single stage.
+    struct Summary: Sendable {
+        let stage: PipelineStage
+        let count: Int
+        let p50: Double
+        let p95: Double
+        let p99: Double
+        let totalSeconds: Double
+        let bytes: Int
+        let rows: Int
+    }
+
+
+    func add(_ stage: PipelineStage, seconds: Double, bytes: Int, rows: Int) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        var samples = stageSamples[stage, default: StageSamples()]
+
+        if samples.seconds.count < PipelineStatistics.maximumNumberOfSamples {
+            samples.seconds.append(seconds)
+        } else {
+            samples.seconds[samples.count % PipelineStatistics.maximumNumberOfSamples] = seconds
+        }
+
+        samples.count += 1
+        samples.totalSeconds += seconds
+        samples.bytes += bytes
+        samples.rows += rows
+
+        stageSamples[stage] = samples
+    }
+
+
+    func reset() {
+        lock.lock()
+        defer { lock.unlock() }
+
+        stageSamples.removeAll()
+    }
+
+
+    /// Summaries in pipeline order for every stage with at least one sample.
+    func summaries() -> [Summary] {
+        lock.lock()
+        let localSamples = stageSamples
+        lock.unlock()
+
+        return PipelineStage.allCases.compactMap { stage in
+            guard let samples = localSamples[stage], !samples.seconds.isEmpty else { return nil }
+
+            let sorted = samples.seconds.sorted()
+
+            return Summary(stage: stage,
+                           count: samples.count,
+                           p50: percentile(0.50, of: sorted),
+                           p95: percentile(0.95, of: sorted),
+                           p99: percentile(0.99, of: sorted),
+                           totalSeconds: samples.totalSeconds,
+                           bytes: samples.bytes,
+                           rows: samples.rows)
+        }
+    }
+
+
+    /// A tab separated table of the summaries with times in milliseconds.
+    func report() -> String {
+        var lines = ["Stage\tCount\tp50 (ms)\tp95 (ms)\tp99 (ms)\tTotal (ms)\tBytes\tRows"]
+
+        for summary in summaries() {
+            let times = [summary.p50, summary.p95, summary.p99, summary.totalSeconds].map { String(format: "%.3f", $0 * 1_000) }
+
+            lines.append(([summary.stage.rawValue, "\(summary.count)"] + times + ["\(summary.bytes)", "\(summary.rows)"]).joined(separator: "\t"))
+        }
+
+        return lines.joined(separator: "\n")
+    }
+
+
+    /// Nearest-rank percentile of sorted values.
+    private func percentile(_ fraction: Double, of sortedValues: [Double]) -> Double {
+        let rank = Int((fraction * Double(sortedValues.count)).rounded(.up))
+        let index = min(max(rank - 1, 0), sortedValues.count - 1)
+
+        return sortedValues[index]
+    }
+}
@@ -0,0 +1,183 @@
+//
+//  PipelineTrace.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+#if canImport(os)
+import os
+#endif
+
+
+/// Stages of the processing pipeline that are timed by PipelineTrace.
+enum PipelineStage: String, CaseIterable, Codable, Sendable {
+    // Parser
+    case readFile
+    case decode
+    case splitLines
+    case tokenize
+    case appendRow
+    case lineNumbers
+    case parse
+
+    // ProcessedData
+    case loadParsedFile
+    case loadGraphTemplate
+    case updateGraph
+    case loadGraphController
+
+    // CacheManager
+    case cacheEncode
+    case cacheWrite
+    case cacheRead
+    case cacheDecode
+}
+
+
+
+/// Structured timing of the processing pipeline.
+///
+/// Every interval is recorded in `PipelineStatistics.shared` and, on platforms with `os`, emitted as an `os_signpost` interval in the "Pipeline" category so it shows up in Instruments.
+///
+/// Example Usage
+///```swift
+/// let interval = PipelineTrace.begin(.loadParsedFile, dataItemID: dataItem.localID)
+/// let parsedFile = try await Parser.parse(url, using: settings, into: dataItem.localID)
+/// interval.end(bytes: parsedFile.content.utf8.count, rows: parsedFile.numberOfRows)
+/// ```
+enum PipelineTrace {
+
+    /// Set to false to skip all timing.  Intervals still have to be ended, but nothing is recorded.
+    static var isEnabled = true
+
+    #if canImport(os)
+    fileprivate static let signposter = OSSignposter(subsystem: Bundle.main.bundleIdentifier ?? "edu.HRG.Graphs", category: "Pipeline")
+    #endif
+
+
+    /// Monotonic time in nanoseconds, or 0 if tracing is disabled.
+    ///
+    /// Used to accumulate the time of stages that run once per line, where an interval per line would be too expensive.
+    static func now() -> UInt64 {
+        guard isEnabled else { return 0 }
+
+        return DispatchTime.now().uptimeNanoseconds
+    }
+
+
+    /// Starts an interval for `stage`.  Call `end(bytes:rows:)` on the returned interval when the stage finishes.
+    static func begin(_ stage: PipelineStage, dataItemID: DataItem.LocalID?) -> PipelineInterval {
+        return PipelineInterval(stage: stage, dataItemID: dataItemID)
+    }
+
+
+    /// Times `body` as a single interval.
+    static func measure<T>(_ stage: PipelineStage, dataItemID: DataItem.LocalID?, bytes: Int = 0, rows: Int = 0, _ body: () throws -> T) rethrows -> T {
+        let interval = begin(stage, dataItemID: dataItemID)
+        let output = try body()
+        interval.end(bytes: bytes, rows: rows)
+        return output
+    }
+
+
+    /// Records a stage whose time was accumulated with `now()` instead of measured as one interval.
+    static func record(_ stage: PipelineStage, nanoseconds: UInt64, dataItemID: DataItem.LocalID?, bytes: Int = 0, rows: Int = 0) {
+        guard isEnabled else { return }
+
+        let seconds = Double(nanoseconds) / 1_000_000_000
+
+        PipelineStatistics.shared.add(stage, seconds: seconds, bytes: bytes, rows: rows)
+
+        #if canImport(os)
+        let dataItem = dataItemID?.id.uuidString ?? "none"
+        signposter.emitEvent(stage.signpostName, "dataItem: \(dataItem, privacy: .public) seconds: \(seconds) bytes: \(bytes) rows: \(rows)")
+        #endif
+    }
+}
+
+
+
+/// An interval started by `PipelineTrace.begin(_:dataItemID:)`.
+struct PipelineInterval {
+    let stage: PipelineStage
+
+    let dataItemID: DataItem.LocalID?
+
+    private let start: UInt64
+
+    #if canImport(os)
+    private let signpostState: OSSignpostIntervalState?
+    #endif
+
+
+    fileprivate init(stage: PipelineStage, dataItemID: DataItem.LocalID?) {
+        self.stage = stage
+        self.dataItemID = dataItemID
+
+        #if canImport(os)
+        if PipelineTrace.isEnabled {
+            let dataItem = dataItemID?.id.uuidString ?? "none"
+            let signposter = PipelineTrace.signposter
+            signpostState = signposter.beginInterval(stage.signpostName, id: signposter.makeSignpostID(), "dataItem: \(dataItem, privacy: .public)")
+        } else {
+            signpostState = nil
+        }
+        #endif
+
+        self.start = PipelineTrace.now()
+    }
+
+
+    /// Ends the interval.
+    ///
+    /// - Parameters:
+    ///   - bytes: Number of bytes processed by the stage.
+    ///   - rows: Number of data rows processed by the stage.
+    /// - Returns: The duration of the interval in seconds, or 0 if tracing is disabled.
+    @discardableResult
+    func end(bytes: Int = 0, rows: Int = 0) -> Double {
+        guard PipelineTrace.isEnabled, start != 0 else { return 0 }
+
+        let seconds = Double(PipelineTrace.now() - start) / 1_000_000_000
+
+        PipelineStatistics.shared.add(stage, seconds: seconds, bytes: bytes, rows: rows)
+
+        #if canImport(os)
+        if let signpostState {
+            PipelineTrace.signposter.endInterval(stage.signpostName, signpostState, "bytes: \(bytes) rows: \(rows)")
+        }
+        #endif
+        
+        return seconds
+    }
+}
+
+
+
+#if canImport(os)
+extension PipelineStage {
+    /// Signpost names have to be static strings.
+    fileprivate var signpostName: StaticString {
+        switch self {
+        case .readFile: return "readFile"
+        case .decode: return "decode"
+        case .splitLines: return "splitLines"
+        case .tokenize: return "tokenize"
+        case .appendRow: return "appendRow"
+        case .lineNumbers: return "lineNumbers"
+        case .parse: return "parse"
+        case .loadParsedFile: return "loadParsedFile"
+        case .loadGraphTemplate: return "loadGraphTemplate"
+        case .updateGraph: return "updateGraph"
+        case .loadGraphController: return "loadGraphController"
+        case .cacheEncode: return "cacheEncode"
+        case .cacheWrite: return "cacheWrite"
+        case .cacheRead: return "cacheRead"
+        case .cacheDecode: return "cacheDecode"
+        }
+    }
+}
+#endif
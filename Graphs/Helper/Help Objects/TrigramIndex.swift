@@ -0,0 +1,219 @@
+//
+//  TrigramIndex.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+/// Case insensitive substring search over the text of many keys.
+///
+/// Every lowercased text is split into the overlapping three byte sequences (trigrams) of its UTF8.  A query only checks the keys that contain every trigram of the query, and a query that extends the previous query (e.g. while typing) only checks the previous matches.
+///
+/// Updating a key gives it a new slot and leaves the old slot behind as a tombstone; the postings are compacted once the tombstones outnumber the live keys.
+///
+/// Example Usage
+///```swift
+/// var index = TrigramIndex<UUID>()
+/// index.update(id, text: "Raman Spectrum\nSample 12")
+/// let matches = index.keys(matching: "spec")
+/// ```
+struct TrigramIndex<Key: Hashable> {
+
+    private typealias Slot = Int32
+
+    private typealias Trigram = UInt32
+
+    /// Lowercased text of each slot, nil for tombstones.
+    private var texts: [String?] = []
+
+    private var keysOfSlots: [Key?] = []
+
+    private var slotsOfKeys: [Key : Slot] = [:]
+
+    /// Slots that contain each trigram, in increasing order.
+    private var postings: [Trigram : [Slot]] = [:]
+
+    private var numberOfTombstones = 0
+
+
+    // Incremental refinement
+    private var lastQuery: String? = nil
+    private var lastMatches: [Slot] = []
+
+
+    var count: Int {
+        slotsOfKeys.count
+    }
+
+
+
+    // MARK: - Updating
+    /// Indexes `text` for `key`, replacing any earlier text.
+    mutating func update(_ key: Key, text: String) {
+        let lowercasedText = text.lowercased()
+
+        if let slot = slotsOfKeys[key], texts[Int(slot)] == lowercasedText { return }
+
+        remove(key)
+
+        let slot = Slot(texts.count)
+
+        texts.append(lowercasedText)
+        keysOfSlots.append(key)
+        slotsOfKeys[key] = slot
+
+        for nextTrigram in TrigramIndex.trigrams(of: lowercasedText) {
+            postings[nextTrigram, default: []].append(slot)
+        }
+
+        lastQuery = nil
+    }
+
+
+    mutating func remove(_ key: Key) {
+        guard let slot = slotsOfKeys.removeValue(forKey: key) else { return }
+
+        texts[Int(slot)] = nil
+        keysOfSlots[Int(slot)] = nil
+        numberOfTombstones += 1
+
+        lastQuery = nil
+
+        if numberOfTombstones > max(slotsOfKeys.count, 1024) {
+            compact()
+        }
+    }
+
+
+    mutating func removeAll() {
+        self = TrigramIndex()
+    }
+
+
+    /// Rebuilds the postings without the tombstones.
+    private mutating func compact() {
+        let liveEntries = zip(keysOfSlots, texts).compactMap { key, text in
+            key.flatMap { key in text.map { (key, $0) } }
+        }
+
+        removeAll()
+
+        for (nextKey, nextText) in liveEntries {
+            update(nextKey, text: nextText)
+        }
+    }
+
+
+
+    // MARK: - Querying
+    /// Keys whose text contains `query`, ignoring case.
+    mutating func keys(matching query: String) -> [Key] {
+        let lowercasedQuery = query.lowercased()
+
+        if lowercasedQuery.isEmpty {
+            return Array(slotsOfKeys.keys)
+        }
+
+        let candidates: [Slot]
+
+        if let lastQuery, lowercasedQuery.contains(lastQuery) {
+            // Anything that matches the longer query also matched the previous one
+            candidates = lastMatches
+        } else {
+            candidates = self.candidates(for: lowercasedQuery)
+        }
+
+        let matches = candidates.filter { nextSlot in
+            texts[Int(nextSlot)]?.contains(lowercasedQuery) ?? false
+        }
+
+        lastQuery = lowercasedQuery
+        lastMatches = matches
+
+        return matches.compactMap { keysOfSlots[Int($0)] }
+    }
+
+
+    /// True if the text of `key` contains `query`, ignoring case.
+    func contains(_ key: Key, _ query: String) -> Bool {
+        guard let slot = slotsOfKeys[key], let text = texts[Int(slot)] else { return false }
+
+        return query.isEmpty || text.contains(query.lowercased())
+    }
+
+
+    /// Slots that contain every trigram of the query.  Short queries check every slot.
+    private func candidates(for lowercasedQuery: String) -> [Slot] {
+        let queryTrigrams = Set(TrigramIndex.trigrams(of: lowercasedQuery))
+
+        if queryTrigrams.isEmpty {
+            return texts.indices.compactMap { texts[$0] == nil ? nil : Slot($0) }
+        }
+
+        var lists: [[Slot]] = []
+
+        for nextTrigram in queryTrigrams {
+            guard let list = postings[nextTrigram] else { return [] }
+            lists.append(list)
+        }
+
+        lists.sort { $0.count < $1.count }
+
+        // Intersecting the two shortest lists is enough; the text check removes the rest
+        var output = lists[0]
+
+        if lists.count > 1 {
+            output = TrigramIndex.intersection(output, lists[1])
+        }
+
+        return output
+    }
+
+
+    /// Intersection of two lists in increasing order.
+    private static func intersection(_ lhs: [Slot], _ rhs: [Slot]) -> [Slot] {
+        var output: [Slot] = []
+        output.reserveCapacity(min(lhs.count, rhs.count))
+
+        var lhsIndex = 0
+        var rhsIndex = 0
+
+        while lhsIndex < lhs.count && rhsIndex < rhs.count {
+            if lhs[lhsIndex] < rhs[rhsIndex] {
+                lhsIndex += 1
+            } else if lhs[lhsIndex] > rhs[rhsIndex] {
+                rhsIndex += 1
+            } else {
+                output.append(lhs[lhsIndex])
+                lhsIndex += 1
+                rhsIndex += 1
+            }
+        }
+
+        return output
+    }
+
+
+    /// Distinct trigrams of the UTF8 of `text`.
+    private static func trigrams(of text: String) -> Set<Trigram> {
+        var output: Set<Trigram> = []
+
+        var window: Trigram = 0
+        var numberOfBytes = 0
+
+        for nextByte in text.utf8 {
+            window = ((window << 8) | Trigram(nextByte)) & 0xFFFFFF
+            numberOfBytes += 1
+
+            if numberOfBytes >= 3 {
+                output.insert(window)
+            }
+        }
+
+        return output
+    }
+}
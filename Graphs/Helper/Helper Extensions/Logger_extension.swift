@@ -34,4 +34,7 @@ extension Logger {
     
     /// Logs ProcessData Errors
     static let processingData = Logger(subsystem: subsystem, category: "processingData")
+    
+    /// Logs File System Watching Errors
+    static let fileSystem = Logger(subsystem: subsystem, category: "fileSystem")
 }
@@ -42,6 +42,14 @@ extension Notification.Name {
     static var graphTemplateDidChange = Notification.Name("graphTemplateOnDataItemsDidChange")
     
     
+    /** Notification Name for when the FileMetadataStore finished reading a batch of files
+     
+     UserInfo Keys : Values
+     - urls : [URL].  Key to the files whose metadata was read
+     */
+    static var fileMetadataDidChange = Notification.Name("fileMetadataDidChange")
+    
+    
     static var selectedDataItemDidChange = Notification.Name("selectedDataItemDidChange")
     
     static var exportSelectionAsDataGraphFiles = Notification.Name("exportSelectionAsDataGraphFiles")
@@ -64,6 +72,8 @@ extension Notification {
         static var oldParserSettingLocalID = "oldParserSettingLocalID"
         static var newParserSettingLocalID = "newParserSettingLocalID"
         
+        static var urls = "urls"
+        
         
     }
 }
@@ -0,0 +1,25 @@
+//
+//  StringCollection_Extensions.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+extension Collection where Element == String {
+    func allAreEmpty() -> Bool {
+        var areEmpty = true
+        
+        for nextString in self {
+            if !nextString.isEmpty {
+                areEmpty = false
+                break
+            }
+        }
+        
+        return areEmpty
+    }
+}
@@ -149,6 +149,51 @@ extension URL {
     }
     
     
+    /// File URL of the ProcessingProfiles of every Data Item
+    ///
+    /// Uses the URL.cacheStorageDirectory as the base URL
+    static var processingProfilesURL: URL {
+        let location = URL.cacheStorageDirectory
+        return location.appending(path: "ProcessingProfiles.json")
+    }
+    
+    
+    /// File URL of the ColumnStatistics of every cached ParsedFile
+    ///
+    /// Uses the URL.cacheStorageDirectory as the base URL
+    static var columnStatisticsURL: URL {
+        let location = URL.cacheStorageDirectory
+        return location.appending(path: "ColumnStatistics.plist")
+    }
+    
+    
+    /// File URL of the snapshot of the last session (selection and processed Data Items)
+    ///
+    /// Kept outside of the cache so that emptying the cache keeps the selection
+    static var sessionSnapshotURL: URL {
+        let location = URL.applicationSupportDirectory
+        return location.appending(path: "Graphs/Session.json")
+    }
+    
+    
+    /// File URL of the CacheManifest snapshot
+    ///
+    /// Uses the URL.cacheStorageDirectory as the base URL
+    static var cacheManifestURL: URL {
+        let location = URL.cacheStorageDirectory
+        return location.appending(path: "CacheManifest.plist")
+    }
+    
+    
+    /// File URL of the changes made to the CacheManifest since its snapshot
+    ///
+    /// Uses the URL.cacheStorageDirectory as the base URL
+    static var cacheManifestJournalURL: URL {
+        let location = URL.cacheStorageDirectory
+        return location.appending(path: "CacheManifest.journal")
+    }
+    
+    
     /// Date that the URL was last modified
     var dateLastModified: Date? {
         let resourceValues = try? self.resourceValues(forKeys: [.contentModificationDateKey])
@@ -157,6 +202,12 @@ extension URL {
     }
     
     
+    /// Path used to match the file with the paths reported by the FileSystemWatcher.
+    var watchedPath: String {
+        FileSystemWatcher.normalized(self.standardizedFileURL.path(percentEncoded: false))
+    }
+    
+    
     var fileExists: Bool {
         let fm = FileManager.default
         
@@ -0,0 +1,16 @@
+//
+//  UserDefaults_cacheBudget.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+extension UserDefaults {
+    /// Largest size of the cache in bytes.  Zero for no limit.
+    static let cacheBudget: String = "cacheBudget"
+    
+    static let defaultCacheBudget: Int = 5_000_000_000
+}
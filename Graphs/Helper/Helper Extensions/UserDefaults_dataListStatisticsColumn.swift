@@ -0,0 +1,16 @@
+//
+//  UserDefaults_dataListStatisticsColumn.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+extension UserDefaults {
+    /// Zero based index of the parsed column whose statistics are shown in the Data List.
+    static let dataListStatisticsColumn: String = "dataListStatisticsColumn"
+    
+    static let defaultDataListStatisticsColumn: Int = 1
+}
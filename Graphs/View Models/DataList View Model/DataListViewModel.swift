@@ -59,6 +59,8 @@ class DataListViewModel {
         for nextDataItem in dataItems {
             nextDataItem.userNotes = newInfo
         }
+        
+        dataController.apply(ModelChanges(editedDataItems: dataItems))
     }
 }
 
@@ -74,6 +76,27 @@ extension DataListViewModel {
 
 
 
+// MARK: - File Metadata
+extension DataListViewModel {
+    /// Number of rows above and below an appearing row whose file metadata is read ahead of scrolling.
+    static let numberOfPrefetchedNeighbors = 40
+    
+    
+    /// Queues the file metadata of the rows around `dataItem` so that they are filled in before they scroll into view.
+    func prefetchFileMetadata(around dataItem: DataItem) {
+        let visableItems = dataController.visableItems
+        
+        guard let index = visableItems.firstIndex(of: dataItem) else { return }
+        
+        let neighbors = DataListViewModel.numberOfPrefetchedNeighbors
+        let range = max(index - neighbors, 0) ..< min(index + neighbors + 1, visableItems.count)
+        
+        FileMetadataStore.shared.prefetch(visableItems.elements[range].map { $0.url })
+    }
+}
+
+
+
 // MARK: - Open in Finder
 extension DataListViewModel {
     func openInFinder(_ dataItem: DataItem) {
@@ -109,6 +132,11 @@ extension DataListViewModel {
     var numberOfVisibleDataItems: Int {
         dataItems.count
     }
+    
+    /// Progress of the bulk operation that is currently running, or nil.
+    var operationProgress: OperationProgress? {
+        dataController.operationProgress
+    }
 
 }
 
@@ -39,6 +39,7 @@ class DataItemsInspectorViewModel {
                 if dataItems.count == 1 {
                     if let onlyDataItem = dataItems.first {
                         onlyDataItem.name = newValue
+                        dataController.apply(ModelChanges(editedDataItems: [onlyDataItem]))
                     }
                 }
             }
@@ -94,6 +95,7 @@ class DataItemsInspectorViewModel {
             if dataItems.count == 1 {
                 guard let dataItem = dataItems.first else { return }
                 dataItem.userNotes = newValue
+                dataController.apply(ModelChanges(editedDataItems: [dataItem]))
             }
         }
     }
@@ -133,6 +135,8 @@ class DataItemsInspectorViewModel {
         for nextDataItem in dataItems {
             nextDataItem.name = name
         }
+        
+        dataController.apply(ModelChanges(editedDataItems: dataItems))
     }
     
     
@@ -186,7 +190,7 @@ extension DataItemsInspectorViewModel {
     // MARK: - Parser Selection
     
     func updateParserSetting(with inputType: InputType, and newParserSettings: ParserSettings?) {
-        for nextDataItem in dataItems {
+        dataController.performInBatches("Assigning Parser", on: dataItems) { nextDataItem in
             nextDataItem.setParserSetting(withInputType: inputType, and: newParserSettings)
         }
     }
@@ -220,7 +224,7 @@ extension DataItemsInspectorViewModel {
     
     // MARK: - Graph Template Selection
     func updateGraphtemplate(with inputType: InputType, and newGraphTemplate: GraphTemplate?) {
-        for nextDataItem in dataItems {
+        dataController.performInBatches("Assigning Graph Template", on: dataItems) { nextDataItem in
             nextDataItem.setGraphTemplate(withInputType: inputType, and: newGraphTemplate)
         }
     }
@@ -105,7 +105,7 @@ extension GraphTemplateInspectorViewModel {
         let graphTemplateID = graphTemplate.id
         
         for nextSelectedDataItem in selectedDataItems {
-            let selectedDataItemGraphTemplate = nextSelectedDataItem.getAssociatedGraphTemplate()
+            let selectedDataItemGraphTemplate = EffectiveSettingsResolver.shared.graphTemplate(for: nextSelectedDataItem)
             let id = selectedDataItemGraphTemplate?.id
             
             if id == graphTemplateID {
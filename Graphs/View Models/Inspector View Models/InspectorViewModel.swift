@@ -28,6 +28,10 @@ class InspectorViewModel {
     
     var tableInspectorVM: TableInspectorViewModel
     
+    var statisticsInspectorVM: StatisticsInspectorViewModel
+    
+    var parsePreviewVM: ParsePreviewViewModel
+    
     
     var firstDataItem: DataItem? {
         dataController.selectedDataItems.first
@@ -51,6 +55,10 @@ class InspectorViewModel {
         
         self.tableInspectorVM = TableInspectorViewModel(dataController, processDataManager)
         
+        self.statisticsInspectorVM = StatisticsInspectorViewModel(dataController, processDataManager)
+        
+        self.parsePreviewVM = ParsePreviewViewModel(dataController)
+        
     }
     
     
@@ -111,4 +119,8 @@ extension InspectorViewModel {
     var toolTip_TableInspector: String {
         return "View your parsed data in a table.  Note: nothing will appear if the Data doesn't have a Parser with the proper settings."
     }
+    
+    var toolTip_StatisticsInspector: String {
+        return "View the minimum, maximum, mean, standard deviation, NaN count and order of each parsed column.  Right click a column to show its statistics in the Data List."
+    }
 }
@@ -46,6 +46,7 @@ class NodeInspectorViewModel {
                 if nodesCount == 1 {
                     if let onlyNode = nodes.first {
                         onlyNode.name = newValue
+                        dataController.apply(ModelChanges(editedNodes: [onlyNode]))
                     }
                 }
             }
@@ -67,6 +68,7 @@ class NodeInspectorViewModel {
             if nodes.count == 1 {
                 guard let node = nodes.first else { return }
                 node.userNotes = newValue
+                dataController.apply(ModelChanges(editedNodes: [node]))
             }
         }
     }
@@ -96,6 +98,8 @@ class NodeInspectorViewModel {
         for nextNode in nodes {
             nextNode.name = name
         }
+        
+        dataController.apply(ModelChanges(editedNodes: nodes))
     }
     
     var disableNameTextfield: Bool {
@@ -126,8 +130,7 @@ extension NodeInspectorViewModel {
     // MARK: - Parser Selection
     
     func updateParserSetting(with inputType: InputType, and newParserSettings: ParserSettings?) {
-        for nextNode in nodes {
-            
+        dataController.performInBatches("Assigning Parser", on: nodes) { nextNode in
             nextNode.setParserSetting(withInputType: inputType, and: newParserSettings)
         }
     }
@@ -163,7 +166,7 @@ extension NodeInspectorViewModel {
     
     // MARK: - Graph Template Selection
     func updateGraphtemplate(with inputType: InputType, and newGraphTemplate: GraphTemplate?) {
-        for nextNode in nodes {
+        dataController.performInBatches("Assigning Graph Template", on: nodes) { nextNode in
             nextNode.setGraphTemplate(withInputType: inputType, and: newGraphTemplate)
         }
     }
@@ -0,0 +1,163 @@
+//
+//  ParsePreviewViewModel.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+import SwiftUI
+
+
+/// Drives the ParseViewer with a bounded preview parse of the selected Data Item.
+///
+/// Previews are regenerated on every Parser Settings change.  The full parse of the selected Data Items is handled by the ProcessDataManager once the changes are committed.
+@Observable
+@MainActor
+class ParsePreviewViewModel {
+    private var dataController: DataController
+
+    private var dataItem: DataItem? {
+        dataController.selectedDataItems.first
+    }
+
+
+    // MARK: View State
+    var viewIsVisable: Bool = false {
+        didSet {
+            if viewIsVisable {
+                updatePreview()
+            }
+        }
+    }
+
+    private(set) var preview: ParsePreview?
+
+    private(set) var tableData = TableData(columns: [])
+
+    /// Numbered lines colored by their ParseLineType.
+    private(set) var coloredContent = AttributedString()
+
+    private var previewTask: Task<Void, Never>?
+
+
+    var content: String {
+        preview?.content ?? ""
+    }
+
+
+    var summary: String {
+        guard let preview else { return "" }
+
+        if let parserError = preview.parserError {
+            return "Parser error: \(parserError)"
+        }
+
+        if preview.isComplete {
+            return ""
+        }
+
+        let numberOfLines = preview.lines.count(where: { $0.section == .beginning })
+        let fileSize = ByteCountFormatter.string(fromByteCount: Int64(preview.fileSize), countStyle: .file)
+
+        return "Previewing the first \(numberOfLines) lines of \(fileSize)"
+    }
+
+
+    // MARK: - Initialization
+    init(_ dataController: DataController) {
+        self.dataController = dataController
+        self.registerForNotifications()
+    }
+
+
+    // MARK: - Updating State
+    func updatePreview() {
+        previewTask?.cancel()
+
+        guard viewIsVisable,
+              let dataItem,
+              let staticSettings = dataItem.getAssociatedParserSettings()?.parserSettingsStatic else {
+            setPreview(nil)
+            return
+        }
+
+        let url = dataItem.url
+        let localID = dataItem.localID
+
+        previewTask = Task {
+            let newPreview = await Task.detached(priority: .userInitiated) {
+                try? Parser.preview(url, using: staticSettings, into: localID)
+            }.value
+
+            if Task.isCancelled { return }
+
+            self.setPreview(newPreview)
+        }
+    }
+
+
+    private func setPreview(_ newPreview: ParsePreview?) {
+        preview = newPreview
+        tableData = TableData(columns: newPreview?.parsedFile.data ?? [])
+        coloredContent = Self.coloredContent(for: newPreview)
+    }
+
+
+    private static func coloredContent(for preview: ParsePreview?) -> AttributedString {
+        guard let preview else { return AttributedString() }
+
+        let size = (preview.lines.last(where: { $0.lineNumber != nil })?.lineNumber ?? 0).size
+
+        let formatter = NumberFormatter()
+        formatter.minimumIntegerDigits = size
+
+        var output = AttributedString()
+        var previousSection: ParsePreview.Section = .beginning
+
+        for nextLine in preview.lines {
+            if nextLine.section != previousSection {
+                output.append(AttributedString(ParsePreview.sectionMarker + "\n"))
+                previousSection = nextLine.section
+            }
+
+            let numberString = nextLine.lineNumber.flatMap { formatter.string(from: $0 as NSNumber) } ?? ParsePreview.sectionMarker
+
+            var nextString = AttributedString(numberString + "\t" + nextLine.content + "\n")
+            nextString.foregroundColor = nextLine.lineType.color
+
+            output.append(nextString)
+        }
+
+        return output
+    }
+}
+
+
+
+// MARK: - Notifications
+extension ParsePreviewViewModel {
+    fileprivate func registerForNotifications() {
+        let nc = NotificationCenter.default
+
+        nc.addObserver(self,
+                       selector: #selector(previewNeedsUpdate(_:)),
+                       name: .selectedDataItemDidChange,
+                       object: nil)
+
+        nc.addObserver(self,
+                       selector: #selector(previewNeedsUpdate(_:)),
+                       name: .parserSettingPropertyDidChange,
+                       object: nil)
+
+        nc.addObserver(self,
+                       selector: #selector(previewNeedsUpdate(_:)),
+                       name: .parserOnNodeOrDataItemDidChange,
+                       object: nil)
+    }
+
+    @objc func previewNeedsUpdate(_ notification: Notification) {
+        self.updatePreview()
+    }
+}
@@ -116,7 +116,7 @@ extension ParserSettingsViewModel {
 extension ParserSettingsViewModel {
     func foregroundColor(for parserSetting: ParserSettings) -> Color {
         
-        let dataItemParserSettings = selectedDataItem?.getAssociatedParserSettings()
+        let dataItemParserSettings = selectedDataItem.flatMap { EffectiveSettingsResolver.shared.parserSettings(for: $0) }
         
         
         if dataItemParserSettings?.localID == parserSetting.localID {
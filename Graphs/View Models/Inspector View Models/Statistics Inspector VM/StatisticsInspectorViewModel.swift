@@ -0,0 +1,169 @@
+//
+//  StatisticsInspectorViewModel.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+@Observable
+@MainActor
+class StatisticsInspectorViewModel {
+    var dataController: DataController
+    var processDataManager: ProcessDataManager
+    
+    fileprivate var dataItem: DataItem? {
+        dataController.selectedDataItems.first
+    }
+    
+    /// One row per parsed column, in the order of the columns.
+    private(set) var rows: [Row] = []
+    
+    // MARK: View State
+    var viewIsVisable: Bool = false {
+        didSet {
+            updateStatistics()
+        }
+    }
+    
+    
+    @ObservationIgnored
+    private var pendingUpdate: Task<Void, Never>?
+    
+    /// The selection changed while an update was in progress.
+    @ObservationIgnored
+    private var needsUpdate = false
+    
+    
+    struct Row: Identifiable {
+        /// Zero based index of the column.
+        let id: Int
+        
+        let header: String
+        
+        let statistics: ColumnStatistics
+        
+        var title: String {
+            let columnName = "Column \(id + 1)"
+            
+            return header.isEmpty ? columnName : columnName + ": " + header.replacingOccurrences(of: "\n", with: " ")
+        }
+    }
+    
+    
+    // MARK: - Initialization
+    init(_ dataController: DataController, _ processDataManager: ProcessDataManager) {
+        self.dataController = dataController
+        self.processDataManager = processDataManager
+        registerForNotifications()
+    }
+    
+    
+    // MARK: - Updating State
+    /// Reads the statistics cached for the Data Item's ParsedFile, or computes them if the file isn't cached.
+    private func updateStatistics() {
+        
+        if viewIsVisable == false { return }
+        
+        if pendingUpdate != nil {
+            needsUpdate = true
+            return
+        }
+        
+        guard let dataItem else {
+            rows = []
+            return
+        }
+        
+        pendingUpdate = Task {
+            rows = await statisticsRows(for: dataItem)
+            
+            pendingUpdate = nil
+            
+            if needsUpdate {
+                needsUpdate = false
+                updateStatistics()
+            }
+        }
+    }
+    
+    
+    private func statisticsRows(for dataItem: DataItem) async -> [Row] {
+        let processedData = await processDataManager.processedData(for: dataItem)
+        
+        // Statistics cover every column, not just the ones used by the Graph Template
+        await processedData.loadAllColumns()
+        
+        guard let parsedFile = processedData.parsedFile else { return [] }
+        
+        var columnStatistics = ColumnStatisticsStore.shared.statistics(of: dataItem.localID) ?? []
+        
+        if columnStatistics.count != parsedFile.data.count {
+            columnStatistics = await ColumnStatistics.statistics(of: parsedFile)
+            
+            recordStatistics(columnStatistics, of: dataItem)
+        }
+        
+        return zip(parsedFile.data, columnStatistics).enumerated().map { nextIndex, nextPair in
+            Row(id: nextIndex, header: nextPair.0.header, statistics: nextPair.1)
+        }
+    }
+    
+    
+    /// Stores statistics computed here under the ContentKey of the Data Item's cached ParsedFile, so the Data List shows them too.
+    ///
+    /// Statistics are only kept for a cached file that is up to date, otherwise they would describe another version of the file.
+    private func recordStatistics(_ columnStatistics: [ColumnStatistics], of dataItem: DataItem) {
+        guard CacheManager.shared.parsedFileCacheState(for: dataItem) == .cachedStorageUpToDate,
+              let contentKey = CacheManifest.shared.cachedFile(.parsedFile, of: dataItem.localID)?.contentKey,
+              CacheManifest.shared.isStored(contentKey) else { return }
+        
+        ColumnStatisticsStore.shared.record(columnStatistics, for: contentKey)
+    }
+}
+
+
+
+// MARK: - Data List
+extension StatisticsInspectorViewModel {
+    
+    func isShownInDataList(_ row: Row) -> Bool {
+        ColumnStatisticsStore.shared.dataListColumnIndex == row.id
+    }
+    
+    
+    /// Shows the statistics of the column in the statistics columns of the Data List.
+    func showInDataList(_ row: Row) {
+        ColumnStatisticsStore.shared.dataListColumnIndex = row.id
+    }
+}
+
+
+
+// MARK: - UI
+extension StatisticsInspectorViewModel {
+    var dataItemName: String {
+        dataItem?.name ?? "Select Data"
+    }
+}
+
+
+
+// MARK: - Notifications
+extension StatisticsInspectorViewModel {
+    fileprivate func registerForNotifications() {
+        let nc = NotificationCenter.default
+        
+        nc.addObserver(self,
+                       selector: #selector(selectedDataItemDidChange(_:)),
+                       name: .selectedDataItemDidChange,
+                       object: nil)
+    }
+    
+    @objc func selectedDataItemDidChange(_ notification: Notification) {
+        self.updateStatistics()
+    }
+}
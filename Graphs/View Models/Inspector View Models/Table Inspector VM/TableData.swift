@@ -8,37 +8,26 @@
 
 import Foundation
 
+/// The columns of a ParsedFile shown as a table.
+///
+/// Rows are identified by their index and cells are read from the columns, so no per row storage is created and opening a file of any size costs the same.
 struct TableData: Identifiable {
     var id = ID()
     
-    var rows: [TableDataRow]
-    var columns: [DataColumn]
+    let columns: [DataColumn]
+    
+    /// Number of rows of the longest column.
+    let numberOfRows: Int
     
     init(columns: [DataColumn]) {
         self.columns = columns
-        self.rows = []
-        rows = generateRows(using: columns)
-        
+        self.numberOfRows = columns.reduce(0) { max($0, $1.data.count) }
     }
     
-    private func maxRows(_ columns: [DataColumn]) -> Int {
-        let maxColumn = columns.max(by: {$0.data.count > $1.data.count})
-        return maxColumn?.data.count ?? 0
-    }
     
-    private func generateRows(using columns: [DataColumn]) -> [TableDataRow] {
-        let maxRows = self.maxRows(columns)
-        
-        var outputRows: [TableDataRow] = []
-        outputRows.reserveCapacity(maxRows)
-        
-        for rowNumber in 0..<maxRows {
-            let newRow = TableDataRow(rowNumber: rowNumber + 1)
-            outputRows.append(newRow)
-        }
-        
-        return outputRows
-        
+    /// The value of a cell, or an empty string where the column is shorter than the table.
+    func value(atRow rowIndex: Int, column columnIndex: Int) -> String {
+        columns[columnIndex].value(at: rowIndex)
     }
     
     
@@ -68,34 +57,41 @@ extension TableData {
         return output
     }
     
-    func rowString(for id: TableDataRow.ID) -> String {
-        let rowNumber = rowNumber(for: id)
-        return rowString(for: rowNumber)
-    }
-    
-    
-    private func rowNumber(for id: TableDataRow.ID) -> Int? {
-        let row = rows.first(where: { $0.id == id })
-        return row?.rowNumber
-    }
     
-    private func rowString(for index: Int?) -> String {
-        guard let rowIndex = index else { return "" }
-        if columns.isEmpty { return "" }
+    /// The header and the rows as tab separated lines, in the order of the rows.
+    func tabSeparatedString(forRows rowIndices: IndexSet) -> String {
+        var output = ""
         
-        var output: String = ""
+        // Rough size of the cells, so that the string grows only a few times
+        output.reserveCapacity(rowIndices.count * max(columns.count, 1) * 8)
         
-        for (columnIndex, nextColumn) in columns.enumerated() {
-            let nextDataString = nextColumn.data(for: rowIndex)
-            if columnIndex == 0 {
-                output.append(nextDataString)
-            } else {
-                output.append("\t\(nextDataString)")
+        var isFirstLine = true
+        
+        if let headerString = headerString() {
+            output.append(headerString)
+            isFirstLine = false
+        }
+        
+        for nextRowIndex in rowIndices where nextRowIndex < numberOfRows {
+            if !isFirstLine {
+                output.append("\n")
             }
+            
+            appendRow(at: nextRowIndex, to: &output)
+            isFirstLine = false
         }
+        
         return output
     }
     
     
-    
+    private func appendRow(at rowIndex: Int, to output: inout String) {
+        for (columnIndex, nextColumn) in columns.enumerated() {
+            if columnIndex != 0 {
+                output.append("\t")
+            }
+            
+            output.append(nextColumn.value(at: rowIndex))
+        }
+    }
 }
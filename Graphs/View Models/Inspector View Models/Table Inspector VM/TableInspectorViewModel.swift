@@ -38,11 +38,14 @@ class TableInspectorViewModel {
     
     private var internalTableData: TableData
     
-    var selection: Set<TableDataRow.ID> = []
+    /// Indices of the selected rows.
+    var selection = IndexSet()
     
     // MARK: View State
     var viewIsVisable: Bool = false {
         didSet {
+            // The table shows every column, not just the ones used by the Graph Template
+            processDataManager.requiresAllParsedColumns = viewIsVisable
             updateProcessedData()
         }
     }
@@ -85,6 +88,8 @@ class TableInspectorViewModel {
         
         let newTableData = TableData(columns: parsedFile.data)
         
+        // Row indices of the previous table don't refer to the same rows
+        selection = IndexSet()
         internalTableData = newTableData
     }
     
@@ -105,6 +110,8 @@ class TableInspectorViewModel {
             processingState = .inProgress
             let localProcessedData = await processDataManager.processedData(for: dataItem)
             
+            await localProcessedData.loadAllColumns()
+            
             self.processedData = localProcessedData
         }
     }
@@ -114,25 +121,12 @@ class TableInspectorViewModel {
 // MARK: - Exporting
 extension TableInspectorViewModel {
     
-    /// Copies selection as tab separated items
+    /// Copies selection as tab separated items, in the order of the rows
     func copySelection() {
         
         if selection.isEmpty { return }
         
-        var output = ""
-        
-        if let headerString = tableData.headerString() {
-            output.append(headerString)
-        }
-        
-        for nextSelectionID in selection {
-            let rowString = tableData.rowString(for: nextSelectionID)
-            if output.isEmpty {
-                output.append(rowString)
-            } else {
-                output.append("\n\(rowString)")
-            }
-        }
+        let output = tableData.tabSeparatedString(forRows: selection)
         
         if output.isEmpty { return }
         
@@ -50,6 +50,12 @@ struct StoredContent {
         
         
         
+        if reducedNumberOfLines, let dataItemID {
+            setReducedState(from: url, using: parserSettings, into: dataItemID)
+            return
+        }
+        
+        
         guard let localContent = try? Parser.content(for: url, using: parserSettings) else {
             content = "Could not decode file"
             linesNumbers = "0"
@@ -76,6 +82,28 @@ struct StoredContent {
     }
     
     
+    /// Only reads the first 50 lines of the file instead of decoding the entire file.
+    private mutating func setReducedState(from url: URL, using parserSettings: ParserSettingsStatic, into dataItemID: DataItem.LocalID) {
+        var options = ParsePreview.Options()
+        options.maximumNumberOfLines = 50
+        options.numberOfMiddleLines = 0
+        options.numberOfEndLines = 0
+        
+        guard let preview = try? Parser.preview(url, using: parserSettings, into: dataItemID, options: options) else {
+            content = "Could not decode file"
+            linesNumbers = "0"
+            combinedLineNumbersAndContent = linesNumbers + "\t" + content
+            return
+        }
+        
+        let processedLines = processedLines(lines: preview.lines.map(\.content), using: parserSettings)
+        
+        content = preview.content
+        linesNumbers = processedLines.lineNumbers
+        combinedLineNumbersAndContent = processedLines.combinedLinesAndContent
+    }
+    
+    
     private func lines(from input: String, using newLineType: NewLineType) -> [String] {
         
         let lineTypeLiteral = newLineType.stringLiteral
@@ -0,0 +1,92 @@
+//
+//  CachePreferencesViewModel.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import Foundation
+
+
+@Observable
+@MainActor
+class CachePreferencesViewModel {
+    
+    private var cacheManager: CacheManager
+    
+    private var dataController: DataController
+    
+    
+    // MARK: - Budget
+    /// Budgets offered in Preferences.  Zero for no limit.
+    let budgetOptions: [Int] = [1_000_000_000, 2_000_000_000, 5_000_000_000, 10_000_000_000, 20_000_000_000, 50_000_000_000, 0]
+    
+    var budget: Int = CacheManager.budget {
+        didSet {
+            UserDefaults.standard.set(budget, forKey: UserDefaults.cacheBudget)
+            cacheManager.enforceBudget()
+        }
+    }
+    
+    
+    // MARK: - Initializers
+    init(_ cacheManager: CacheManager, _ dataController: DataController) {
+        self.cacheManager = cacheManager
+        self.dataController = dataController
+    }
+    
+    
+    
+    // MARK: - Actions
+    func compactCache() {
+        cacheManager.compact(existingDataItemIDs: Set(dataController.dataItemsByLocalID.keys))
+    }
+    
+    
+    func emptyCache() {
+        cacheManager.emptyEntireCache()
+    }
+}
+
+
+
+// MARK: - UI
+extension CachePreferencesViewModel {
+    
+    func title(forBudget budget: Int) -> String {
+        budget == 0 ? "No Limit" : scaledSize(budget)
+    }
+    
+    
+    var parsedDataUsage: String {
+        scaledSize(CacheManifest.shared.byteSizes[.parsedFile] ?? 0)
+    }
+    
+    
+    var graphUsage: String {
+        scaledSize(CacheManifest.shared.byteSizes[.graph] ?? 0)
+    }
+    
+    
+    var totalUsage: String {
+        scaledSize(CacheManifest.shared.totalByteSize)
+    }
+    
+    
+    /// Fraction of the budget in use, or nil if there is no limit.
+    var fractionOfBudgetUsed: Double? {
+        if budget == 0 { return nil }
+        
+        return min(Double(CacheManifest.shared.totalByteSize) / Double(budget), 1)
+    }
+    
+    
+    private func scaledSize(_ byteSize: Int) -> String {
+        let bcf = ByteCountFormatter()
+        bcf.allowedUnits = [.useKB, .useMB, .useGB]
+        bcf.countStyle = .file
+        
+        return bcf.string(fromByteCount: Int64(byteSize))
+    }
+}
@@ -125,6 +125,19 @@ extension SourceListViewModel {
 }
 
 
+// MARK: - Renaming Nodes
+extension SourceListViewModel {
+    /// Renames the Node and reports the edit, so that the folder names and paths shown and searched in the Data List are updated.
+    func rename(_ node: Node, to name: String) {
+        if node.name == name { return }
+        
+        node.name = name
+        dataController.apply(ModelChanges(editedNodes: [node]))
+    }
+}
+
+
+
 // MARK: - Deleting DataItems
 extension SourceListViewModel {
     func deleteSelectedDataItems() {
@@ -32,6 +32,10 @@ struct CenterContent: View {
                 Spacer()
                 Text("\(dataListVM.numberOfSelectedDataItems) of \(dataListVM.numberOfVisibleDataItems) selected")
                 Spacer()
+                if let operationProgress = dataListVM.operationProgress {
+                    OperationProgressView(operationProgress)
+                        .padding(.trailing)
+                }
             }
         }
         
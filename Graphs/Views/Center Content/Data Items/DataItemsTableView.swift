@@ -20,9 +20,17 @@ struct DataItemsTableView: View {
     
     var body: some View {
         Table(selection: $viewModel.selection, sortOrder: $viewModel.sort, columnCustomization: $customization) {
-            TableColumn("Name", value: \.name) {
-                Text($0.name)
-                    .help($0.url.path(percentEncoded: false))
+            TableColumn("Name", value: \.name) { dataItem in
+                HStack(spacing: 4) {
+                    Text(dataItem.name)
+                        .help(dataItem.url.path(percentEncoded: false))
+                    
+                    if dataItem.hasChangedFile {
+                        Image(systemName: "arrow.triangle.2.circlepath")
+                            .foregroundStyle(.secondary)
+                            .help("Changed on disk since it was last parsed")
+                    }
+                }
             }
             .customizationID("name")
 
@@ -48,8 +56,9 @@ struct DataItemsTableView: View {
             }
             .customizationID("parserSettings")
             
-             TableColumn("File Size", value: \.fileSize) {
-                 Text($0.scaledFileSize)
+             TableColumn("File Size", value: \.fileSize) { dataItem in
+                 Text(dataItem.scaledFileSize)
+                     .onAppear { viewModel.prefetchFileMetadata(around: dataItem) }
              }
              .alignment(.center)
              .customizationID("fileSize")
@@ -76,13 +85,105 @@ struct DataItemsTableView: View {
              .customizationID("rating")
             
             
-             TableColumn("Modified Date", value: \.contentModificationDate) {
-                 Text($0.contentModificationDate.formatted(date: .numeric, time: .omitted))
-                 
+             TableColumn("Modified Date", value: \.contentModificationDate) { dataItem in
+                 Text(dataItem.contentModificationDate.formatted(date: .numeric, time: .omitted))
+                     .onAppear { viewModel.prefetchFileMetadata(around: dataItem) }
              }
              .alignment(.center)
              .customizationID("contentModificationDate")
             
+            
+            // Processing Profile.  Hidden until enabled from the table header menu
+            TableColumn("Parse Time", value: \.parseMilliseconds) {
+                Text(milliseconds($0.parseMilliseconds))
+            }
+            .alignment(.trailing)
+            .customizationID("parseTime")
+            .defaultVisibility(.hidden)
+            
+            TableColumn("Graph Time", value: \.graphMilliseconds) {
+                Text(milliseconds($0.graphMilliseconds))
+            }
+            .alignment(.trailing)
+            .customizationID("graphTime")
+            .defaultVisibility(.hidden)
+            
+            TableColumn("Lines", value: \.parsedLineCount) {
+                Text(count($0.parsedLineCount))
+            }
+            .alignment(.trailing)
+            .customizationID("parsedLineCount")
+            .defaultVisibility(.hidden)
+            
+            TableColumn("Rows", value: \.parsedRowCount) {
+                Text(count($0.parsedRowCount))
+            }
+            .alignment(.trailing)
+            .customizationID("parsedRowCount")
+            .defaultVisibility(.hidden)
+            
+            TableColumn("Columns", value: \.parsedColumnCount) {
+                Text(count($0.parsedColumnCount))
+            }
+            .alignment(.trailing)
+            .customizationID("parsedColumnCount")
+            .defaultVisibility(.hidden)
+            
+            TableColumn("Peak Memory", value: \.peakBytesHeld) {
+                Text(bytes($0.peakBytesHeld))
+                    .help("Estimated memory held while parsing")
+            }
+            .alignment(.trailing)
+            .customizationID("peakBytesHeld")
+            .defaultVisibility(.hidden)
+            
+            TableColumn("Cache", value: \.cacheResult)
+                .alignment(.center)
+                .customizationID("cacheResult")
+                .defaultVisibility(.hidden)
+            
+            
+            // Column Statistics of the column chosen in the Statistics Inspector.  Hidden until enabled from the table header menu
+            TableColumn("Min of \(statisticsColumnName)", value: \.columnMinimum) {
+                Text(statistic($0, $0.columnMinimum))
+            }
+            .alignment(.trailing)
+            .customizationID("columnMinimum")
+            .defaultVisibility(.hidden)
+            
+            TableColumn("Max of \(statisticsColumnName)", value: \.columnMaximum) {
+                Text(statistic($0, $0.columnMaximum))
+            }
+            .alignment(.trailing)
+            .customizationID("columnMaximum")
+            .defaultVisibility(.hidden)
+            
+            TableColumn("Mean of \(statisticsColumnName)", value: \.columnMean) {
+                Text(statistic($0, $0.columnMean))
+            }
+            .alignment(.trailing)
+            .customizationID("columnMean")
+            .defaultVisibility(.hidden)
+            
+            TableColumn("Std Dev of \(statisticsColumnName)", value: \.columnStandardDeviation) {
+                Text(statistic($0, $0.columnStandardDeviation))
+            }
+            .alignment(.trailing)
+            .customizationID("columnStandardDeviation")
+            .defaultVisibility(.hidden)
+            
+            TableColumn("NaNs in \(statisticsColumnName)", value: \.columnNaNCount) {
+                Text(count($0.columnNaNCount))
+            }
+            .alignment(.trailing)
+            .customizationID("columnNaNCount")
+            .defaultVisibility(.hidden)
+            
+            TableColumn("Order of \(statisticsColumnName)", value: \.columnMonotonicity)
+                .alignment(.center)
+                .customizationID("columnMonotonicity")
+                .defaultVisibility(.hidden)
+            
 
             
             
@@ -115,6 +216,33 @@ struct DataItemsTableView: View {
     }
     
     
+// MARK: - Processing Profile Formatting
+    private func milliseconds(_ value: Double) -> String {
+        value == 0 ? "" : value.formatted(.number.precision(.fractionLength(1))) + " ms"
+    }
+    
+    private func count(_ value: Int) -> String {
+        value == 0 ? "" : value.formatted()
+    }
+    
+    private func bytes(_ value: Int) -> String {
+        value == 0 ? "" : Int64(value).formatted(.byteCount(style: .memory))
+    }
+    
+    
+// MARK: - Column Statistics Formatting
+    private var statisticsColumnName: String {
+        "Column \(ColumnStatisticsStore.shared.dataListColumnIndex + 1)"
+    }
+    
+    /// An empty string if the Data Item has no cached statistics for the column.
+    private func statistic(_ dataItem: DataItem, _ value: Double) -> String {
+        guard dataItem.dataListColumnStatistics != nil else { return "" }
+        
+        return value.formatted(.number.precision(.significantDigits(1...6)))
+    }
+    
+    
 // MARK: - Buttons
     private var Button_Delete: some View {
         Button("Delete") { viewModel.deleteSelectedDataItems() }
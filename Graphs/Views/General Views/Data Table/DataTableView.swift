@@ -0,0 +1,203 @@
+//
+//  DataTableView.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import SwiftUI
+import AppKit
+
+/// Shows TableData in an NSTableView.
+///
+/// The table view asks for the number of rows and creates cells only for the visible rows, reading them from the columns of the TableData, so a table with millions of rows opens and scrolls like a short one.
+struct DataTableView: NSViewRepresentable {
+
+    var tableData: TableData
+
+    @Binding var selection: IndexSet
+
+    /// Called by the Copy menu item and Command-C.  Nil if the rows can't be copied.
+    var copySelection: (() -> Void)?
+
+
+    init(_ tableData: TableData, selection: Binding<IndexSet> = .constant([]), copySelection: (() -> Void)? = nil) {
+        self.tableData = tableData
+        self._selection = selection
+        self.copySelection = copySelection
+    }
+
+
+    func makeCoordinator() -> Coordinator {
+        Coordinator(self)
+    }
+
+
+    func makeNSView(context: Context) -> NSScrollView {
+        let coordinator = context.coordinator
+
+        let tableView = CopyingTableView()
+        tableView.style = .fullWidth
+        tableView.usesAlternatingRowBackgroundColors = true
+        tableView.allowsMultipleSelection = true
+        tableView.columnAutoresizingStyle = .noColumnAutoresizing
+        tableView.dataSource = coordinator
+        tableView.delegate = coordinator
+
+        if copySelection != nil {
+            tableView.copyHandler = { [weak coordinator] in coordinator?.parent.copySelection?() }
+
+            let menu = NSMenu()
+            menu.addItem(withTitle: "Copy", action: #selector(CopyingTableView.copy(_:)), keyEquivalent: "")
+            tableView.menu = menu
+        }
+
+        let scrollView = NSScrollView()
+        scrollView.documentView = tableView
+        scrollView.hasVerticalScroller = true
+        scrollView.hasHorizontalScroller = true
+        scrollView.autohidesScrollers = true
+
+        coordinator.reload(tableView)
+
+        return scrollView
+    }
+
+
+    func updateNSView(_ scrollView: NSScrollView, context: Context) {
+        let coordinator = context.coordinator
+        coordinator.parent = self
+
+        guard let tableView = scrollView.documentView as? NSTableView else { return }
+
+        if coordinator.tableDataID != tableData.id {
+            coordinator.reload(tableView)
+        }
+
+        if tableView.selectedRowIndexes != selection {
+            tableView.selectRowIndexes(selection, byExtendingSelection: false)
+        }
+    }
+
+
+
+    // MARK: - Coordinator
+    final class Coordinator: NSObject, NSTableViewDataSource, NSTableViewDelegate {
+        var parent: DataTableView
+
+        private(set) var tableDataID: TableData.ID?
+
+        private static let rowNumberIdentifier = NSUserInterfaceItemIdentifier("rowNumber")
+
+        private static let cellIdentifier = NSUserInterfaceItemIdentifier("dataTableCell")
+
+
+        init(_ parent: DataTableView) {
+            self.parent = parent
+        }
+
+
+        /// Replaces the columns with the columns of the TableData and reloads the rows.
+        func reload(_ tableView: NSTableView) {
+            tableDataID = parent.tableData.id
+
+            for nextColumn in tableView.tableColumns {
+                tableView.removeTableColumn(nextColumn)
+            }
+
+            let rowNumberColumn = NSTableColumn(identifier: Coordinator.rowNumberIdentifier)
+            rowNumberColumn.title = "#"
+            rowNumberColumn.minWidth = 5
+            rowNumberColumn.width = 40
+            tableView.addTableColumn(rowNumberColumn)
+
+            // A column is identified by its index in the TableData
+            for (nextIndex, nextColumn) in parent.tableData.columns.enumerated() {
+                let tableColumn = NSTableColumn(identifier: NSUserInterfaceItemIdentifier(String(nextIndex)))
+                tableColumn.title = nextColumn.header
+                tableColumn.minWidth = 15
+                tableColumn.width = 75
+                tableView.addTableColumn(tableColumn)
+            }
+
+            tableView.reloadData()
+        }
+
+
+        func numberOfRows(in tableView: NSTableView) -> Int {
+            parent.tableData.numberOfRows
+        }
+
+
+        func tableView(_ tableView: NSTableView, viewFor tableColumn: NSTableColumn?, row: Int) -> NSView? {
+            guard let tableColumn else { return nil }
+
+            let text: String
+
+            if tableColumn.identifier == Coordinator.rowNumberIdentifier {
+                text = String(row + 1)
+            } else if let columnIndex = Int(tableColumn.identifier.rawValue), columnIndex < parent.tableData.columns.count {
+                text = parent.tableData.value(atRow: row, column: columnIndex)
+            } else {
+                text = ""
+            }
+
+            let cell = (tableView.makeView(withIdentifier: Coordinator.cellIdentifier, owner: self) as? NSTableCellView) ?? makeCell()
+            cell.textField?.stringValue = text
+
+            return cell
+        }
+
+
+        func tableViewSelectionDidChange(_ notification: Notification) {
+            guard let tableView = notification.object as? NSTableView else { return }
+
+            if parent.selection != tableView.selectedRowIndexes {
+                parent.selection = tableView.selectedRowIndexes
+            }
+        }
+
+
+        private func makeCell() -> NSTableCellView {
+            let textField = NSTextField(labelWithString: "")
+            textField.lineBreakMode = .byTruncatingTail
+            textField.translatesAutoresizingMaskIntoConstraints = false
+
+            let cell = NSTableCellView()
+            cell.identifier = Coordinator.cellIdentifier
+            cell.textField = textField
+            cell.addSubview(textField)
+
+            NSLayoutConstraint.activate([
+                textField.leadingAnchor.constraint(equalTo: cell.leadingAnchor, constant: 2),
+                textField.trailingAnchor.constraint(equalTo: cell.trailingAnchor, constant: -2),
+                textField.centerYAnchor.constraint(equalTo: cell.centerYAnchor)
+            ])
+
+            return cell
+        }
+    }
+
+
+
+    // MARK: - Copying
+    /// Handles Command-C and the Copy menu item.
+    final class CopyingTableView: NSTableView {
+        var copyHandler: (() -> Void)?
+
+
+        @objc func copy(_ sender: Any?) {
+            copyHandler?()
+        }
+
+
+        override func validateUserInterfaceItem(_ item: NSValidatedUserInterfaceItem) -> Bool {
+            if item.action == #selector(copy(_:)) {
+                return copyHandler != nil && !selectedRowIndexes.isEmpty
+            }
+
+            return super.validateUserInterfaceItem(item)
+        }
+    }
+}
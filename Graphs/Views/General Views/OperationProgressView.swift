@@ -0,0 +1,54 @@
+//
+//  OperationProgressView.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import SwiftUI
+
+/// Compact progress bar with a cancel button for the status bar.
+struct OperationProgressView: View {
+
+    var progress: OperationProgress
+
+    init(_ progress: OperationProgress) {
+        self.progress = progress
+    }
+
+
+    var body: some View {
+        HStack {
+            Text(progress.title)
+                .bold()
+
+            if let fractionCompleted = progress.fractionCompleted {
+                ProgressView(value: fractionCompleted)
+                    .frame(width: 120)
+            } else {
+                ProgressView()
+                    .controlSize(.small)
+            }
+
+            Text(progress.summary)
+                .monospacedDigit()
+                .foregroundStyle(.secondary)
+
+            Button_Cancel
+        }
+        .font(.caption)
+    }
+
+
+    private var Button_Cancel: some View {
+        Button {
+            progress.cancel()
+        } label: {
+            Image(systemName: "xmark.circle.fill")
+        }
+        .buttonStyle(.borderless)
+        .disabled(progress.isCancelled)
+        .help("Cancel \(progress.title)")
+    }
+}
@@ -102,6 +102,10 @@ struct Inspector: View {
                 Image(systemName: "tablecells")
                     .help(viewModel.toolTip_TableInspector)
                     .foregroundStyle(foreground(for: .table))
+            case .statistics:
+                Image(systemName: "function")
+                    .help(viewModel.toolTip_StatisticsInspector)
+                    .foregroundStyle(foreground(for: .statistics))
             }
         }.font(.title2)
     }
@@ -116,6 +120,7 @@ struct Inspector: View {
             case .parserSettings: ParserInspector(viewModel)
             case .text: TextInspector(viewModel.textInspectorVM)
             case .table: TableInspector(viewModel.tableInspectorVM)
+            case .statistics: StatisticsInspector(viewModel.statisticsInspectorVM)
             }
         }
     }
@@ -139,6 +144,7 @@ struct Inspector: View {
         case parserSettings
         case text
         case table
+        case statistics
     }
     
     
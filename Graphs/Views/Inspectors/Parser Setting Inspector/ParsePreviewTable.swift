@@ -0,0 +1,23 @@
+//
+//  ParsePreviewTable.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import SwiftUI
+
+/// Shows the columns of a ParsePreview.
+struct ParsePreviewTable: View {
+
+    var tableData: TableData
+
+    init(_ tableData: TableData) {
+        self.tableData = tableData
+    }
+
+    var body: some View {
+        DataTableView(tableData)
+    }
+}
@@ -9,60 +9,40 @@
 import SwiftUI
 
 struct ParseViewer: View {
-    @Bindable var tableViewModel: TableInspectorViewModel
-    @Bindable var textViewModel: TextInspectorViewModel
+    @Bindable var viewModel: ParsePreviewViewModel
     
     
     @AppStorage("selectedTab_ParseViewer") private var selectedTab: ParseViewTab = .simple
     
-    init(_ tableViewModel: TableInspectorViewModel, _ textViewModel: TextInspectorViewModel) {
-        self.tableViewModel = tableViewModel
-        self.textViewModel = textViewModel
+    init(_ viewModel: ParsePreviewViewModel) {
+        self.viewModel = viewModel
     }
     
     var body: some View {
         VStack {
             Tabs
+            PreviewSummary
             TabContent
         }
         .background(.white)
-        .onAppear {
-            textViewModel.parseInpsectorViewIsVisible = true
-            tableViewModel.viewIsVisable = true
-        }
-        .onDisappear {
-            textViewModel.parseInpsectorViewIsVisible = false
-            tableViewModel.viewIsVisable = false
-        }
+        .onAppear { viewModel.viewIsVisable = true }
+        .onDisappear { viewModel.viewIsVisable = false }
     }
     
+    
     @ViewBuilder
-    private var OriginalTabView: some View {
-        TabView {
-            Tab("Simple", systemImage: "text.document") {
-                Text_Simple
-                    .onAppear { textViewModel.parseInpsectorViewIsVisible = true }
-                    .onDisappear { textViewModel.parseInpsectorViewIsVisible = false }
-            }
-            
-            Tab("Numbered", systemImage: "list.number") {
-                Text_numbered
-                    .onAppear { textViewModel.parseInpsectorViewIsVisible = true }
-                    .onDisappear { textViewModel.parseInpsectorViewIsVisible = false }
-            }
-            
-            Tab("Table", systemImage: "tablecells") {
-                TableInspector(tableViewModel)
-                    .onAppear { tableViewModel.viewIsVisable = true }
-                    .onDisappear { tableViewModel.viewIsVisable = false }
-            }
+    private var PreviewSummary: some View {
+        if !viewModel.summary.isEmpty {
+            Text(viewModel.summary)
+                .font(.caption)
+                .foregroundStyle(.secondary)
         }
     }
     
     
     // MARK: - Text Views
     private var Text_Simple: some View {
-        TextEditor(text: Binding.constant(textViewModel.content))
+        TextEditor(text: Binding.constant(viewModel.content))
         //.lineLimit(100)
             .frame(maxWidth: .infinity)
             .monospaced()
@@ -71,21 +51,23 @@ struct ParseViewer: View {
             .fixedSize(horizontal: false, vertical: false)
     }
     
+    /// Numbered lines colored by their ParseLineType
     private var Text_numbered: some View {
-        TextEditor(text: Binding.constant(textViewModel.combinedLineNumbersAndContent))
-        //.lineLimit(100)
-            .frame(maxWidth: .infinity)
-            .monospaced()
-            .lineSpacing(2)
-            .multilineTextAlignment(.leading)
-            .fixedSize(horizontal: false, vertical: false)
+        ScrollView {
+            Text(viewModel.coloredContent)
+                .frame(maxWidth: .infinity, alignment: .leading)
+                .monospaced()
+                .lineSpacing(2)
+                .multilineTextAlignment(.leading)
+                .textSelection(.enabled)
+        }
     }
 }
 
 #Preview {
     @Previewable
     @State var controller: AppController = AppController()
-    ParseViewer(controller.inspectorVM.tableInspectorVM, controller.inspectorVM.textInspectorVM)
+    ParseViewer(controller.inspectorVM.parsePreviewVM)
 }
 
 
@@ -119,16 +101,10 @@ extension ParseViewer {
             switch selectedTab {
             case .simple:
                 Text_Simple
-                    .onAppear { textViewModel.parseInpsectorViewIsVisible = true }
-                    .onDisappear { textViewModel.parseInpsectorViewIsVisible = false }
             case .numbered:
                 Text_numbered
-                    .onAppear { textViewModel.parseInpsectorViewIsVisible = true }
-                    .onDisappear { textViewModel.parseInpsectorViewIsVisible = false }
             case .table:
-                TableInspector(tableViewModel)
-                    .onAppear { tableViewModel.viewIsVisable = true }
-                    .onDisappear { tableViewModel.viewIsVisable = false }
+                ParsePreviewTable(viewModel.tableData)
             }
         }
     }
@@ -86,10 +86,10 @@ struct ParserInspector: View {
     var FileContentView: some View {
         // ParseViewer
         if let dataItem = viewModel.parserSettingsVM.selectedDataItem {
-            if dataItem.getAssociatedParserSettings()?.id == viewModel.parserSettingsVM.selection?.id {
+            if EffectiveSettingsResolver.shared.parserSettings(for: dataItem)?.id == viewModel.parserSettingsVM.selection?.id {
                  VStack {
                      Divider()
-                     ParseViewer(viewModel.tableInspectorVM, viewModel.textInspectorVM)
+                     ParseViewer(viewModel.parsePreviewVM)
                  }
                  .background(.white)
             } else {
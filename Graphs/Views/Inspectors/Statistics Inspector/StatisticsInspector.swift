@@ -0,0 +1,108 @@
+//
+//  StatisticsInspector.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import SwiftUI
+
+struct StatisticsInspector: View {
+    
+    var viewModel: StatisticsInspectorViewModel
+    
+    init(_ viewModel: StatisticsInspectorViewModel) {
+        self.viewModel = viewModel
+    }
+    
+    var body: some View {
+        List {
+            ForEach(viewModel.rows) { row in
+                Section {
+                    StatisticsGrid(row.statistics)
+                } header: {
+                    SectionHeader(for: row)
+                }
+                .contextMenu {
+                    Button("Show in Data List") { viewModel.showInDataList(row) }
+                        .disabled(viewModel.isShownInDataList(row))
+                }
+            }
+        }
+        .onAppear { viewModel.viewIsVisable = true }
+        .onDisappear { viewModel.viewIsVisable = false }
+    }
+    
+    
+    private func SectionHeader(for row: StatisticsInspectorViewModel.Row) -> some View {
+        HStack {
+            Text(row.title)
+                .lineLimit(1)
+                .help(row.header)
+            
+            Spacer()
+            
+            if viewModel.isShownInDataList(row) {
+                Image(systemName: "list.bullet.rectangle")
+                    .help("Shown in the statistics columns of the Data List")
+            }
+        }
+    }
+    
+    
+    private func StatisticsGrid(_ statistics: ColumnStatistics) -> some View {
+        Grid(alignment: .leading, horizontalSpacing: 12, verticalSpacing: 2) {
+            StatisticRow("Numbers", count(statistics.numberOfValues))
+            StatisticRow("NaNs", count(statistics.numberOfNaNs))
+            StatisticRow("Empty", count(statistics.numberOfEmptyCells))
+            
+            if statistics.numberOfValues > 0 {
+                StatisticRow("Min", number(statistics.minimum))
+                StatisticRow("Max", number(statistics.maximum))
+                StatisticRow("Mean", number(statistics.mean))
+                StatisticRow("Std Dev", number(statistics.standardDeviation))
+                StatisticRow("Order", monotonicity(statistics.monotonicity))
+            }
+        }
+        .font(.callout)
+    }
+    
+    
+    private func StatisticRow(_ label: String, _ value: String) -> some View {
+        GridRow {
+            Text(label)
+                .foregroundStyle(.secondary)
+            Text(value)
+                .textSelection(.enabled)
+                .monospacedDigit()
+        }
+    }
+    
+    
+// MARK: - Formatting
+    private func count(_ value: Int) -> String {
+        value.formatted()
+    }
+    
+    private func number(_ value: Double) -> String {
+        value.formatted(.number.precision(.significantDigits(1...6)))
+    }
+    
+    private func monotonicity(_ value: ColumnStatistics.Monotonicity) -> String {
+        switch value {
+        case .constant: return "Constant"
+        case .increasing: return "Increasing"
+        case .decreasing: return "Decreasing"
+        case .none: return "Not Monotonic"
+        }
+    }
+}
+
+
+
+ #Preview {
+     @Previewable
+     @State var viewModel = StatisticsInspectorViewModel(DataController(withDelegate: nil), ProcessDataManager(cacheManager: CacheManager(), dataSource: nil))
+     StatisticsInspector(viewModel)
+ }
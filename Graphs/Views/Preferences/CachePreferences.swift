@@ -0,0 +1,57 @@
+//
+//  CachePreferences.swift
+//  Graphs
+//
+//  Created by Owen Hildreth on 10/19/26.
+//  Copyright © 2026 Connor Barnes. All rights reserved.
+//
+
+import SwiftUI
+
+struct CachePreferences: View {
+    @Bindable var viewModel: CachePreferencesViewModel
+    
+    init(_ viewModel: CachePreferencesViewModel) {
+        self.viewModel = viewModel
+    }
+    
+    var body: some View {
+        Form {
+            Picker("Cache Budget", selection: $viewModel.budget) {
+                ForEach(viewModel.budgetOptions, id: \.self) {
+                    Text(viewModel.title(forBudget: $0))
+                }
+            }
+            .help("Least recently used cached files are removed once the cache is larger than the budget")
+            
+            Section("Usage") {
+                LabeledContent("Parsed Data", value: viewModel.parsedDataUsage)
+                LabeledContent("Graphs", value: viewModel.graphUsage)
+                LabeledContent("Total", value: viewModel.totalUsage)
+                
+                if let fractionOfBudgetUsed = viewModel.fractionOfBudgetUsed {
+                    ProgressView(value: fractionOfBudgetUsed)
+                }
+            }
+            
+            HStack {
+                Button("Compact Now", action: viewModel.compactCache)
+                    .help("Remove cached files of deleted Data Items and files over the budget")
+                Button("Empty Cache", action: viewModel.emptyCache)
+                    .help("Remove every cached file")
+            }
+        }
+        .padding()
+        .frame(minWidth: 350)
+    }
+}
+
+
+
+// MARK: - Preview
+#Preview {
+    @Previewable
+    @State var appController = AppController()
+    
+    CachePreferences(appController.cachePreferencesVM)
+}
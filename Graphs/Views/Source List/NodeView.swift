@@ -10,18 +10,33 @@ import SwiftUI
 
 struct NodeView: View {
     @Bindable var sourceListVM: SourceListViewModel
-    @Bindable var node: Node
+    var node: Node
+    
+    /// The name being edited.  Committed on submit or when the field loses focus.
+    @State private var name: String
+    
+    @FocusState private var isEditingName: Bool
     
     init(_ sourceListVM: SourceListViewModel, _ node: Node) {
         self.sourceListVM = sourceListVM
         self.node = node
+        self._name = State(initialValue: node.name)
     }
     
     var body: some View {
         HStack {
             Image(systemName: "folder.fill")
                 .foregroundStyle(.secondary)
-            TextField("", text: $node.name)
+            TextField("", text: $name)
+                .focused($isEditingName)
+                .onSubmit { sourceListVM.rename(node, to: name) }
+                .onChange(of: isEditingName) { _, isEditing in
+                    if !isEditing { sourceListVM.rename(node, to: name) }
+                }
+                .onChange(of: node.name) { _, newName in
+                    // e.g. renamed in the inspector
+                    name = newName
+                }
         }
         .draggable(DropItem(node))
         